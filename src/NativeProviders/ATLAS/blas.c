@@ -1,5 +1,8 @@
 #include "wrapper_common.h"
 #include "blas.h"
+#include "blas_common.h"
+
+#include <stddef.h>
 
 #if __cplusplus
 extern "C" { 
@@ -56,6 +59,122 @@ DLLEXPORT Complex16 z_dot_product(const int n, const Complex16 x[], const Comple
 	return ret;
 }
 
+DLLEXPORT Complex8 c_conjugate_dot_product(const int n, const Complex8 x[], const Complex8 y[]){
+	Complex8 ret;
+	cblas_cdotc_sub(n, x, 1, y, 1, &ret);
+	return ret;
+}
+
+DLLEXPORT Complex16 z_conjugate_dot_product(const int n, const Complex16 x[], const Complex16 y[]){
+	Complex16 ret;
+	cblas_zdotc_sub(n, x, 1, y, 1, &ret);
+	return ret;
+}
+
+DLLEXPORT float s_vector_norm(const int n, const float x[]){
+	return cblas_snrm2(n, x, 1);
+}
+
+DLLEXPORT double d_vector_norm(const int n, const double x[]){
+	return cblas_dnrm2(n, x, 1);
+}
+
+DLLEXPORT float c_vector_norm(const int n, const Complex8 x[]){
+	return cblas_scnrm2(n, x, 1);
+}
+
+DLLEXPORT double z_vector_norm(const int n, const Complex16 x[]){
+	return cblas_dznrm2(n, x, 1);
+}
+
+DLLEXPORT float s_absolute_sum(const int n, const float x[]){
+	return cblas_sasum(n, x, 1);
+}
+
+DLLEXPORT double d_absolute_sum(const int n, const double x[]){
+	return cblas_dasum(n, x, 1);
+}
+
+DLLEXPORT float c_absolute_sum(const int n, const Complex8 x[]){
+	return cblas_scasum(n, x, 1);
+}
+
+DLLEXPORT double z_absolute_sum(const int n, const Complex16 x[]){
+	return cblas_dzasum(n, x, 1);
+}
+
+DLLEXPORT int s_max_abs_index(const int n, const float x[]){
+	return (int)cblas_isamax(n, x, 1);
+}
+
+DLLEXPORT int d_max_abs_index(const int n, const double x[]){
+	return (int)cblas_idamax(n, x, 1);
+}
+
+DLLEXPORT int c_max_abs_index(const int n, const Complex8 x[]){
+	return (int)cblas_icamax(n, x, 1);
+}
+
+DLLEXPORT int z_max_abs_index(const int n, const Complex16 x[]){
+	return (int)cblas_izamax(n, x, 1);
+}
+
+DLLEXPORT void s_rotate(const int n, float x[], float y[], const float c, const float s){
+	cblas_srot(n, x, 1, y, 1, c, s);
+}
+
+DLLEXPORT void d_rotate(const int n, double x[], double y[], const double c, const double s){
+	cblas_drot(n, x, 1, y, 1, c, s);
+}
+
+DLLEXPORT void c_rotate(const int n, Complex8 x[], Complex8 y[], const float c, const float s){
+	cblas_csrot(n, x, 1, y, 1, c, s);
+}
+
+DLLEXPORT void z_rotate(const int n, Complex16 x[], Complex16 y[], const double c, const double s){
+	cblas_zdrot(n, x, 1, y, 1, c, s);
+}
+
+DLLEXPORT void s_rotate_generate(float* a, float* b, float* c, float* s){
+	cblas_srotg(a, b, c, s);
+}
+
+DLLEXPORT void d_rotate_generate(double* a, double* b, double* c, double* s){
+	cblas_drotg(a, b, c, s);
+}
+
+DLLEXPORT void s_swap(const int n, float x[], float y[]){
+	cblas_sswap(n, x, 1, y, 1);
+}
+
+DLLEXPORT void d_swap(const int n, double x[], double y[]){
+	cblas_dswap(n, x, 1, y, 1);
+}
+
+DLLEXPORT void c_swap(const int n, Complex8 x[], Complex8 y[]){
+	cblas_cswap(n, x, 1, y, 1);
+}
+
+DLLEXPORT void z_swap(const int n, Complex16 x[], Complex16 y[]){
+	cblas_zswap(n, x, 1, y, 1);
+}
+
+DLLEXPORT void s_copy(const int n, const float x[], float y[]){
+	cblas_scopy(n, x, 1, y, 1);
+}
+
+DLLEXPORT void d_copy(const int n, const double x[], double y[]){
+	cblas_dcopy(n, x, 1, y, 1);
+}
+
+DLLEXPORT void c_copy(const int n, const Complex8 x[], Complex8 y[]){
+	cblas_ccopy(n, x, 1, y, 1);
+}
+
+DLLEXPORT void z_copy(const int n, const Complex16 x[], Complex16 y[]){
+	cblas_zcopy(n, x, 1, y, 1);
+}
+
 DLLEXPORT void s_matrix_multiply(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float x[], const float y[], const float beta, float c[]){
 	int lda = transA == CblasNoTrans ? m : k;
 	int ldb = transB == CblasNoTrans ? k : n;
@@ -84,6 +203,202 @@ DLLEXPORT void z_matrix_multiply(const enum CBLAS_TRANSPOSE transA, const enum C
 	cblas_zgemm(CblasColMajor, transA, transB, m, n, k, &alpha, x, lda, y, ldb, &beta, c, m);
 }
 
+DLLEXPORT void s_matrix_multiply_view(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float x[], const ptrdiff_t xOffset, const blas_int lda, const float y[], const ptrdiff_t yOffset, const blas_int ldb, const float beta, float c[], const ptrdiff_t cOffset, const blas_int ldc){
+	cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + xOffset, lda, y + yOffset, ldb, beta, c + cOffset, ldc);
+}
+
+DLLEXPORT void d_matrix_multiply_view(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double x[], const ptrdiff_t xOffset, const blas_int lda, const double y[], const ptrdiff_t yOffset, const blas_int ldb, const double beta, double c[], const ptrdiff_t cOffset, const blas_int ldc){
+	cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + xOffset, lda, y + yOffset, ldb, beta, c + cOffset, ldc);
+}
+
+DLLEXPORT void c_matrix_multiply_view(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const Complex8 alpha, const Complex8 x[], const ptrdiff_t xOffset, const blas_int lda, const Complex8 y[], const ptrdiff_t yOffset, const blas_int ldb, const Complex8 beta, Complex8 c[], const ptrdiff_t cOffset, const blas_int ldc){
+	cblas_cgemm(CblasColMajor, transA, transB, m, n, k, &alpha, x + xOffset, lda, y + yOffset, ldb, &beta, c + cOffset, ldc);
+}
+
+DLLEXPORT void z_matrix_multiply_view(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const Complex16 alpha, const Complex16 x[], const ptrdiff_t xOffset, const blas_int lda, const Complex16 y[], const ptrdiff_t yOffset, const blas_int ldb, const Complex16 beta, Complex16 c[], const ptrdiff_t cOffset, const blas_int ldc){
+	cblas_zgemm(CblasColMajor, transA, transB, m, n, k, &alpha, x + xOffset, lda, y + yOffset, ldb, &beta, c + cOffset, ldc);
+}
+
+DLLEXPORT void s_matrix_vector_multiply(const enum CBLAS_TRANSPOSE trans, const int m, const int n, const float alpha, const float a[], const float x[], const float beta, float y[]){
+	cblas_sgemv(CblasColMajor, trans, m, n, alpha, a, m, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void d_matrix_vector_multiply(const enum CBLAS_TRANSPOSE trans, const int m, const int n, const double alpha, const double a[], const double x[], const double beta, double y[]){
+	cblas_dgemv(CblasColMajor, trans, m, n, alpha, a, m, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void c_matrix_vector_multiply(const enum CBLAS_TRANSPOSE trans, const int m, const int n, const Complex8 alpha, const Complex8 a[], const Complex8 x[], const Complex8 beta, Complex8 y[]){
+	cblas_cgemv(CblasColMajor, trans, m, n, &alpha, a, m, x, 1, &beta, y, 1);
+}
+
+DLLEXPORT void z_matrix_vector_multiply(const enum CBLAS_TRANSPOSE trans, const int m, const int n, const Complex16 alpha, const Complex16 a[], const Complex16 x[], const Complex16 beta, Complex16 y[]){
+	cblas_zgemv(CblasColMajor, trans, m, n, &alpha, a, m, x, 1, &beta, y, 1);
+}
+
+DLLEXPORT void s_symmetric_matrix_vector_multiply(const enum CBLAS_UPLO uplo, const int n, const float alpha, const float a[], const float x[], const float beta, float y[]){
+	cblas_ssymv(CblasColMajor, uplo, n, alpha, a, n, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void d_symmetric_matrix_vector_multiply(const enum CBLAS_UPLO uplo, const int n, const double alpha, const double a[], const double x[], const double beta, double y[]){
+	cblas_dsymv(CblasColMajor, uplo, n, alpha, a, n, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void c_hermitian_matrix_vector_multiply(const enum CBLAS_UPLO uplo, const int n, const Complex8 alpha, const Complex8 a[], const Complex8 x[], const Complex8 beta, Complex8 y[]){
+	cblas_chemv(CblasColMajor, uplo, n, &alpha, a, n, x, 1, &beta, y, 1);
+}
+
+DLLEXPORT void z_hermitian_matrix_vector_multiply(const enum CBLAS_UPLO uplo, const int n, const Complex16 alpha, const Complex16 a[], const Complex16 x[], const Complex16 beta, Complex16 y[]){
+	cblas_zhemv(CblasColMajor, uplo, n, &alpha, a, n, x, 1, &beta, y, 1);
+}
+
+DLLEXPORT void s_triangular_matrix_vector_multiply(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int n, const float a[], float x[]){
+	cblas_strmv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void d_triangular_matrix_vector_multiply(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int n, const double a[], double x[]){
+	cblas_dtrmv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void c_triangular_matrix_vector_multiply(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int n, const Complex8 a[], Complex8 x[]){
+	cblas_ctrmv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void z_triangular_matrix_vector_multiply(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int n, const Complex16 a[], Complex16 x[]){
+	cblas_ztrmv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void s_triangular_matrix_vector_solve(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int n, const float a[], float x[]){
+	cblas_strsv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void d_triangular_matrix_vector_solve(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int n, const double a[], double x[]){
+	cblas_dtrsv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void c_triangular_matrix_vector_solve(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int n, const Complex8 a[], Complex8 x[]){
+	cblas_ctrsv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void z_triangular_matrix_vector_solve(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int n, const Complex16 a[], Complex16 x[]){
+	cblas_ztrsv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void s_rank_one_update(const int m, const int n, const float alpha, const float x[], const float y[], float a[]){
+	cblas_sger(CblasColMajor, m, n, alpha, x, 1, y, 1, a, m);
+}
+
+DLLEXPORT void d_rank_one_update(const int m, const int n, const double alpha, const double x[], const double y[], double a[]){
+	cblas_dger(CblasColMajor, m, n, alpha, x, 1, y, 1, a, m);
+}
+
+DLLEXPORT void c_rank_one_update(const int m, const int n, const Complex8 alpha, const Complex8 x[], const Complex8 y[], Complex8 a[]){
+	cblas_cgeru(CblasColMajor, m, n, &alpha, x, 1, y, 1, a, m);
+}
+
+DLLEXPORT void z_rank_one_update(const int m, const int n, const Complex16 alpha, const Complex16 x[], const Complex16 y[], Complex16 a[]){
+	cblas_zgeru(CblasColMajor, m, n, &alpha, x, 1, y, 1, a, m);
+}
+
+DLLEXPORT void c_conjugate_rank_one_update(const int m, const int n, const Complex8 alpha, const Complex8 x[], const Complex8 y[], Complex8 a[]){
+	cblas_cgerc(CblasColMajor, m, n, &alpha, x, 1, y, 1, a, m);
+}
+
+DLLEXPORT void z_conjugate_rank_one_update(const int m, const int n, const Complex16 alpha, const Complex16 x[], const Complex16 y[], Complex16 a[]){
+	cblas_zgerc(CblasColMajor, m, n, &alpha, x, 1, y, 1, a, m);
+}
+
+DLLEXPORT void s_symmetric_rank_k_update(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const int n, const int k, const float alpha, const float a[], const float beta, float c[], const int mirror){
+	const int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_ssyrk(CblasColMajor, uplo, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror)
+	{
+		s_mirror_triangle(uplo == CblasUpper, n, c);
+	}
+}
+
+DLLEXPORT void d_symmetric_rank_k_update(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const int n, const int k, const double alpha, const double a[], const double beta, double c[], const int mirror){
+	const int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_dsyrk(CblasColMajor, uplo, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror)
+	{
+		d_mirror_triangle(uplo == CblasUpper, n, c);
+	}
+}
+
+DLLEXPORT void c_hermitian_rank_k_update(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const int n, const int k, const float alpha, const Complex8 a[], const float beta, Complex8 c[], const int mirror){
+	const int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_cherk(CblasColMajor, uplo, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror)
+	{
+		c_mirror_triangle(uplo == CblasUpper, 1, n, c);
+	}
+}
+
+DLLEXPORT void z_hermitian_rank_k_update(const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const int n, const int k, const double alpha, const Complex16 a[], const double beta, Complex16 c[], const int mirror){
+	const int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_zherk(CblasColMajor, uplo, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror)
+	{
+		z_mirror_triangle(uplo == CblasUpper, 1, n, c);
+	}
+}
+
+DLLEXPORT void s_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const float alpha, const float a[], float b[]){
+	const int lda = side == CblasLeft ? m : n;
+
+	cblas_strsm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+}
+
+DLLEXPORT void d_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const double alpha, const double a[], double b[]){
+	const int lda = side == CblasLeft ? m : n;
+
+	cblas_dtrsm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+}
+
+DLLEXPORT void c_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const Complex8 alpha, const Complex8 a[], Complex8 b[]){
+	const int lda = side == CblasLeft ? m : n;
+
+	cblas_ctrsm(CblasColMajor, side, uplo, trans, diag, m, n, &alpha, a, lda, b, m);
+}
+
+DLLEXPORT void z_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const Complex16 alpha, const Complex16 a[], Complex16 b[]){
+	const int lda = side == CblasLeft ? m : n;
+
+	cblas_ztrsm(CblasColMajor, side, uplo, trans, diag, m, n, &alpha, a, lda, b, m);
+}
+
+DLLEXPORT void s_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const float alpha, const float a[], float b[]){
+	const int lda = side == CblasLeft ? m : n;
+
+	cblas_strmm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+}
+
+DLLEXPORT void d_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const double alpha, const double a[], double b[]){
+	const int lda = side == CblasLeft ? m : n;
+
+	cblas_dtrmm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+}
+
+DLLEXPORT void c_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const Complex8 alpha, const Complex8 a[], Complex8 b[]){
+	const int lda = side == CblasLeft ? m : n;
+
+	cblas_ctrmm(CblasColMajor, side, uplo, trans, diag, m, n, &alpha, a, lda, b, m);
+}
+
+DLLEXPORT void z_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const Complex16 alpha, const Complex16 a[], Complex16 b[]){
+	const int lda = side == CblasLeft ? m : n;
+
+	cblas_ztrmm(CblasColMajor, side, uplo, trans, diag, m, n, &alpha, a, lda, b, m);
+}
+
 #if __cplusplus 
 }
 #endif
\ No newline at end of file
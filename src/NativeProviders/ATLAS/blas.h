@@ -6,4 +6,8 @@
 typedef struct { float real; float imag; } Complex8;
 typedef struct { double real; double imag; } Complex16;
 
+#define blas_int int
+#define blas_complex_float Complex8
+#define blas_complex_double Complex16
+
 #endif
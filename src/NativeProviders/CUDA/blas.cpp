@@ -136,6 +136,18 @@ extern "C" {
 		return ret;
 	}
 
+	DLLEXPORT cuComplex c_conjugate_dot_product(const cublasHandle_t blasHandle, const int n, const cuComplex x[], const cuComplex y[]){
+		cuComplex ret;
+		cuda_dot(blasHandle, n, x, 1, y, 1, &ret, cublasCdotc);
+		return ret;
+	}
+
+	DLLEXPORT cuDoubleComplex z_conjugate_dot_product(const cublasHandle_t blasHandle, const int n, const cuDoubleComplex x[], const cuDoubleComplex y[]){
+		cuDoubleComplex ret;
+		cuda_dot(blasHandle, n, x, 1, y, 1, &ret, cublasZdotc);
+		return ret;
+	}
+
 	DLLEXPORT void s_matrix_multiply(const cublasHandle_t blasHandle, cublasOperation_t transA, cublasOperation_t transB, const int m, const int n, const int k, const float alpha, const float x[], const float y[], const float beta, float c[]){
 		int lda = transA == CUBLAS_OP_N ? m : k;
 		int ldb = transB == CUBLAS_OP_N ? k : n;
@@ -46,7 +46,7 @@ extern "C" {
 
 			// LINEAR ALGEBRA
 		case 128: return 1;	// basic dense linear algebra (major - breaking)
-		case 129: return 0;	// basic dense linear algebra (minor - non-breaking)
+		case 129: return 1;	// basic dense linear algebra (minor - non-breaking)
 
 			// OPTIMIZATION
 		case 256: return 0; // basic optimization
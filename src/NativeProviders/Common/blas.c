@@ -1,89 +1,404 @@
 #include "wrapper_common.h"
 #include "blas.h"
+#include "blas_common.h"
+
+#include <stddef.h>
 
 #if __cplusplus
 extern "C" {
 #endif
-DLLEXPORT void s_axpy(const blas_int n, const float alpha, const float x[], float y[]){
+DLLEXPORT void s_axpy(const int n, const float alpha, const float x[], float y[]){
 	cblas_saxpy(n, alpha, x, 1, y, 1);
 }
 
-DLLEXPORT void d_axpy(const blas_int n, const double alpha, const double x[], double y[]){
+DLLEXPORT void d_axpy(const int n, const double alpha, const double x[], double y[]){
 	cblas_daxpy(n, alpha, x, 1, y, 1);
 }
 
-DLLEXPORT void c_axpy(const blas_int n, const blas_complex_float alpha, const blas_complex_float x[], blas_complex_float y[]){
+DLLEXPORT void c_axpy(const int n, const blas_complex_float alpha, const blas_complex_float x[], blas_complex_float y[]){
 	cblas_caxpy(n, (float*)&alpha, (float*)x, 1, (float*)y, 1);
 }
 
-DLLEXPORT void z_axpy(const blas_int n, const blas_complex_double alpha, const blas_complex_double x[], blas_complex_double y[]){
+DLLEXPORT void z_axpy(const int n, const blas_complex_double alpha, const blas_complex_double x[], blas_complex_double y[]){
 	cblas_zaxpy(n, (double*)&alpha, (double*)x, 1, (double*)y, 1);
 }
 
-DLLEXPORT void s_scale(const blas_int n, const float alpha, float x[]){
+DLLEXPORT void s_scale(const int n, const float alpha, float x[]){
 	cblas_sscal(n, alpha, x, 1);
 }
 
-DLLEXPORT void d_scale(const blas_int n, const double alpha, double x[]){
+DLLEXPORT void d_scale(const int n, const double alpha, double x[]){
 	cblas_dscal(n, alpha, x, 1);
 }
 
-DLLEXPORT void c_scale(const blas_int n, const blas_complex_float alpha, blas_complex_float x[]){
+DLLEXPORT void c_scale(const int n, const blas_complex_float alpha, blas_complex_float x[]){
 	cblas_cscal(n, (float*)&alpha, (float*)x, 1);
 }
 
-DLLEXPORT void z_scale(const blas_int n, const blas_complex_double alpha, blas_complex_double x[]){
+DLLEXPORT void z_scale(const int n, const blas_complex_double alpha, blas_complex_double x[]){
 	cblas_zscal(n, (double*)&alpha, (double*)x, 1);
 }
 
-DLLEXPORT float s_dot_product(const blas_int n, const float x[], const float y[]){
+DLLEXPORT float s_dot_product(const int n, const float x[], const float y[]){
 	return cblas_sdot(n, x, 1, y, 1);
 }
 
-DLLEXPORT double d_dot_product(const blas_int n, const double x[], const double y[]){
+DLLEXPORT double d_dot_product(const int n, const double x[], const double y[]){
 	return cblas_ddot(n, x, 1, y, 1);
 }
 
-DLLEXPORT blas_complex_float c_dot_product(const blas_int n, const blas_complex_float x[], const blas_complex_float y[]){
+DLLEXPORT blas_complex_float c_dot_product(const int n, const blas_complex_float x[], const blas_complex_float y[]){
 	blas_complex_float ret;
 	cblas_cdotu_sub(n, (float*)x, 1, (float*)y, 1, &ret);
 	return ret;
 }
 
-DLLEXPORT blas_complex_double z_dot_product(const blas_int n, const blas_complex_double x[], const blas_complex_double y[]){
+DLLEXPORT blas_complex_double z_dot_product(const int n, const blas_complex_double x[], const blas_complex_double y[]){
 	blas_complex_double ret;
 	cblas_zdotu_sub(n, (double*)x, 1, (double*)y, 1, &ret);
 	return ret;
 }
 
-DLLEXPORT void s_matrix_multiply(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const blas_int m, const blas_int n, const blas_int k, const float alpha, const float x[], const float y[], const float beta, float c[]){
+DLLEXPORT blas_complex_float c_conjugate_dot_product(const int n, const blas_complex_float x[], const blas_complex_float y[]){
+	blas_complex_float ret;
+	cblas_cdotc_sub(n, (float*)x, 1, (float*)y, 1, &ret);
+	return ret;
+}
+
+DLLEXPORT blas_complex_double z_conjugate_dot_product(const int n, const blas_complex_double x[], const blas_complex_double y[]){
+	blas_complex_double ret;
+	cblas_zdotc_sub(n, (double*)x, 1, (double*)y, 1, &ret);
+	return ret;
+}
+
+DLLEXPORT float s_vector_norm(const int n, const float x[]){
+	return cblas_snrm2(n, x, 1);
+}
+
+DLLEXPORT double d_vector_norm(const int n, const double x[]){
+	return cblas_dnrm2(n, x, 1);
+}
+
+DLLEXPORT float c_vector_norm(const int n, const blas_complex_float x[]){
+	return cblas_scnrm2(n, (float*)x, 1);
+}
+
+DLLEXPORT double z_vector_norm(const int n, const blas_complex_double x[]){
+	return cblas_dznrm2(n, (double*)x, 1);
+}
+
+DLLEXPORT float s_absolute_sum(const int n, const float x[]){
+	return cblas_sasum(n, x, 1);
+}
+
+DLLEXPORT double d_absolute_sum(const int n, const double x[]){
+	return cblas_dasum(n, x, 1);
+}
+
+DLLEXPORT float c_absolute_sum(const int n, const blas_complex_float x[]){
+	return cblas_scasum(n, (float*)x, 1);
+}
+
+DLLEXPORT double z_absolute_sum(const int n, const blas_complex_double x[]){
+	return cblas_dzasum(n, (double*)x, 1);
+}
+
+DLLEXPORT int s_max_abs_index(const int n, const float x[]){
+	return (blas_int)cblas_isamax(n, x, 1);
+}
+
+DLLEXPORT int d_max_abs_index(const int n, const double x[]){
+	return (blas_int)cblas_idamax(n, x, 1);
+}
+
+DLLEXPORT int c_max_abs_index(const int n, const blas_complex_float x[]){
+	return (blas_int)cblas_icamax(n, (float*)x, 1);
+}
+
+DLLEXPORT int z_max_abs_index(const int n, const blas_complex_double x[]){
+	return (blas_int)cblas_izamax(n, (double*)x, 1);
+}
+
+DLLEXPORT void s_rotate(const int n, float x[], float y[], const float c, const float s){
+	cblas_srot(n, x, 1, y, 1, c, s);
+}
+
+DLLEXPORT void d_rotate(const int n, double x[], double y[], const double c, const double s){
+	cblas_drot(n, x, 1, y, 1, c, s);
+}
+
+DLLEXPORT void c_rotate(const int n, blas_complex_float x[], blas_complex_float y[], const float c, const float s){
+	cblas_csrot(n, (float*)x, 1, (float*)y, 1, c, s);
+}
+
+DLLEXPORT void z_rotate(const int n, blas_complex_double x[], blas_complex_double y[], const double c, const double s){
+	cblas_zdrot(n, (double*)x, 1, (double*)y, 1, c, s);
+}
+
+DLLEXPORT void s_rotate_generate(float* a, float* b, float* c, float* s){
+	cblas_srotg(a, b, c, s);
+}
+
+DLLEXPORT void d_rotate_generate(double* a, double* b, double* c, double* s){
+	cblas_drotg(a, b, c, s);
+}
+
+DLLEXPORT void s_swap(const int n, float x[], float y[]){
+	cblas_sswap(n, x, 1, y, 1);
+}
+
+DLLEXPORT void d_swap(const int n, double x[], double y[]){
+	cblas_dswap(n, x, 1, y, 1);
+}
+
+DLLEXPORT void c_swap(const int n, blas_complex_float x[], blas_complex_float y[]){
+	cblas_cswap(n, (float*)x, 1, (float*)y, 1);
+}
+
+DLLEXPORT void z_swap(const int n, blas_complex_double x[], blas_complex_double y[]){
+	cblas_zswap(n, (double*)x, 1, (double*)y, 1);
+}
+
+DLLEXPORT void s_copy(const int n, const float x[], float y[]){
+	cblas_scopy(n, x, 1, y, 1);
+}
+
+DLLEXPORT void d_copy(const int n, const double x[], double y[]){
+	cblas_dcopy(n, x, 1, y, 1);
+}
+
+DLLEXPORT void c_copy(const int n, const blas_complex_float x[], blas_complex_float y[]){
+	cblas_ccopy(n, (float*)x, 1, (float*)y, 1);
+}
+
+DLLEXPORT void z_copy(const int n, const blas_complex_double x[], blas_complex_double y[]){
+	cblas_zcopy(n, (double*)x, 1, (double*)y, 1);
+}
+
+DLLEXPORT void s_matrix_multiply(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float x[], const float y[], const float beta, float c[]){
 	const blas_int lda = transA == CblasNoTrans ? m : k;
     const blas_int ldb = transB == CblasNoTrans ? k : n;
 
 	cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
 }
 
-DLLEXPORT void d_matrix_multiply(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const blas_int m, const blas_int n, const blas_int k, const double alpha, const double x[], const double y[], const double beta, double c[]){
+DLLEXPORT void d_matrix_multiply(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double x[], const double y[], const double beta, double c[]){
     const blas_int lda = transA == CblasNoTrans ? m : k;
     const blas_int ldb = transB == CblasNoTrans ? k : n;
 
 	cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
 }
 
-DLLEXPORT void c_matrix_multiply(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const blas_int m, const blas_int n, const blas_int k, const blas_complex_float alpha, const blas_complex_float x[], const blas_complex_float y[], const blas_complex_float beta, blas_complex_float c[]){
+DLLEXPORT void c_matrix_multiply(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_float alpha, const blas_complex_float x[], const blas_complex_float y[], const blas_complex_float beta, blas_complex_float c[]){
     const blas_int lda = transA == CblasNoTrans ? m : k;
     const blas_int ldb = transB == CblasNoTrans ? k : n;
 
 	cblas_cgemm(CblasColMajor, transA, transB, m, n, k, (float*)&alpha, (float*)x, lda, (float*)y, ldb, (float*)&beta, (float*)c, m);
 }
 
-DLLEXPORT void z_matrix_multiply(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const blas_int m, const blas_int n, const blas_int k, const blas_complex_double alpha, const blas_complex_double x[], const blas_complex_double y[], const blas_complex_double beta, blas_complex_double c[]){
+DLLEXPORT void z_matrix_multiply(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_double alpha, const blas_complex_double x[], const blas_complex_double y[], const blas_complex_double beta, blas_complex_double c[]){
     const blas_int lda = transA == CblasNoTrans ? m : k;
     const blas_int ldb = transB == CblasNoTrans ? k : n;
 
 	cblas_zgemm(CblasColMajor, transA, transB, m, n, k, (double*)&alpha, (double*)x, lda, (double*)y, ldb, (double*)&beta, (double*)c, m);
 }
 
+DLLEXPORT void s_matrix_multiply_view(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float x[], const ptrdiff_t xOffset, const blas_int lda, const float y[], const ptrdiff_t yOffset, const blas_int ldb, const float beta, float c[], const ptrdiff_t cOffset, const blas_int ldc){
+	cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + xOffset, lda, y + yOffset, ldb, beta, c + cOffset, ldc);
+}
+
+DLLEXPORT void d_matrix_multiply_view(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double x[], const ptrdiff_t xOffset, const blas_int lda, const double y[], const ptrdiff_t yOffset, const blas_int ldb, const double beta, double c[], const ptrdiff_t cOffset, const blas_int ldc){
+	cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + xOffset, lda, y + yOffset, ldb, beta, c + cOffset, ldc);
+}
+
+DLLEXPORT void c_matrix_multiply_view(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_float alpha, const blas_complex_float x[], const ptrdiff_t xOffset, const blas_int lda, const blas_complex_float y[], const ptrdiff_t yOffset, const blas_int ldb, const blas_complex_float beta, blas_complex_float c[], const ptrdiff_t cOffset, const blas_int ldc){
+	cblas_cgemm(CblasColMajor, transA, transB, m, n, k, (float*)&alpha, (float*)(x + xOffset), lda, (float*)(y + yOffset), ldb, (float*)&beta, (float*)(c + cOffset), ldc);
+}
+
+DLLEXPORT void z_matrix_multiply_view(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_double alpha, const blas_complex_double x[], const ptrdiff_t xOffset, const blas_int lda, const blas_complex_double y[], const ptrdiff_t yOffset, const blas_int ldb, const blas_complex_double beta, blas_complex_double c[], const ptrdiff_t cOffset, const blas_int ldc){
+	cblas_zgemm(CblasColMajor, transA, transB, m, n, k, (double*)&alpha, (double*)(x + xOffset), lda, (double*)(y + yOffset), ldb, (double*)&beta, (double*)(c + cOffset), ldc);
+}
+
+DLLEXPORT void s_matrix_vector_multiply(CBLAS_TRANSPOSE trans, const int m, const int n, const float alpha, const float a[], const float x[], const float beta, float y[]){
+	cblas_sgemv(CblasColMajor, trans, m, n, alpha, a, m, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void d_matrix_vector_multiply(CBLAS_TRANSPOSE trans, const int m, const int n, const double alpha, const double a[], const double x[], const double beta, double y[]){
+	cblas_dgemv(CblasColMajor, trans, m, n, alpha, a, m, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void c_matrix_vector_multiply(CBLAS_TRANSPOSE trans, const int m, const int n, const blas_complex_float alpha, const blas_complex_float a[], const blas_complex_float x[], const blas_complex_float beta, blas_complex_float y[]){
+	cblas_cgemv(CblasColMajor, trans, m, n, (float*)&alpha, (float*)a, m, (float*)x, 1, (float*)&beta, (float*)y, 1);
+}
+
+DLLEXPORT void z_matrix_vector_multiply(CBLAS_TRANSPOSE trans, const int m, const int n, const blas_complex_double alpha, const blas_complex_double a[], const blas_complex_double x[], const blas_complex_double beta, blas_complex_double y[]){
+	cblas_zgemv(CblasColMajor, trans, m, n, (double*)&alpha, (double*)a, m, (double*)x, 1, (double*)&beta, (double*)y, 1);
+}
+
+DLLEXPORT void s_symmetric_matrix_vector_multiply(CBLAS_UPLO uplo, const int n, const float alpha, const float a[], const float x[], const float beta, float y[]){
+	cblas_ssymv(CblasColMajor, uplo, n, alpha, a, n, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void d_symmetric_matrix_vector_multiply(CBLAS_UPLO uplo, const int n, const double alpha, const double a[], const double x[], const double beta, double y[]){
+	cblas_dsymv(CblasColMajor, uplo, n, alpha, a, n, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void c_hermitian_matrix_vector_multiply(CBLAS_UPLO uplo, const int n, const blas_complex_float alpha, const blas_complex_float a[], const blas_complex_float x[], const blas_complex_float beta, blas_complex_float y[]){
+	cblas_chemv(CblasColMajor, uplo, n, (float*)&alpha, (float*)a, n, (float*)x, 1, (float*)&beta, (float*)y, 1);
+}
+
+DLLEXPORT void z_hermitian_matrix_vector_multiply(CBLAS_UPLO uplo, const int n, const blas_complex_double alpha, const blas_complex_double a[], const blas_complex_double x[], const blas_complex_double beta, blas_complex_double y[]){
+	cblas_zhemv(CblasColMajor, uplo, n, (double*)&alpha, (double*)a, n, (double*)x, 1, (double*)&beta, (double*)y, 1);
+}
+
+DLLEXPORT void s_triangular_matrix_vector_multiply(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int n, const float a[], float x[]){
+	cblas_strmv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void d_triangular_matrix_vector_multiply(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int n, const double a[], double x[]){
+	cblas_dtrmv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void c_triangular_matrix_vector_multiply(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int n, const blas_complex_float a[], blas_complex_float x[]){
+	cblas_ctrmv(CblasColMajor, uplo, trans, diag, n, (float*)a, n, (float*)x, 1);
+}
+
+DLLEXPORT void z_triangular_matrix_vector_multiply(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int n, const blas_complex_double a[], blas_complex_double x[]){
+	cblas_ztrmv(CblasColMajor, uplo, trans, diag, n, (double*)a, n, (double*)x, 1);
+}
+
+DLLEXPORT void s_triangular_matrix_vector_solve(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int n, const float a[], float x[]){
+	cblas_strsv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void d_triangular_matrix_vector_solve(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int n, const double a[], double x[]){
+	cblas_dtrsv(CblasColMajor, uplo, trans, diag, n, a, n, x, 1);
+}
+
+DLLEXPORT void c_triangular_matrix_vector_solve(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int n, const blas_complex_float a[], blas_complex_float x[]){
+	cblas_ctrsv(CblasColMajor, uplo, trans, diag, n, (float*)a, n, (float*)x, 1);
+}
+
+DLLEXPORT void z_triangular_matrix_vector_solve(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int n, const blas_complex_double a[], blas_complex_double x[]){
+	cblas_ztrsv(CblasColMajor, uplo, trans, diag, n, (double*)a, n, (double*)x, 1);
+}
+
+DLLEXPORT void s_rank_one_update(const int m, const int n, const float alpha, const float x[], const float y[], float a[]){
+	cblas_sger(CblasColMajor, m, n, alpha, x, 1, y, 1, a, m);
+}
+
+DLLEXPORT void d_rank_one_update(const int m, const int n, const double alpha, const double x[], const double y[], double a[]){
+	cblas_dger(CblasColMajor, m, n, alpha, x, 1, y, 1, a, m);
+}
+
+DLLEXPORT void c_rank_one_update(const int m, const int n, const blas_complex_float alpha, const blas_complex_float x[], const blas_complex_float y[], blas_complex_float a[]){
+	cblas_cgeru(CblasColMajor, m, n, (float*)&alpha, (float*)x, 1, (float*)y, 1, (float*)a, m);
+}
+
+DLLEXPORT void z_rank_one_update(const int m, const int n, const blas_complex_double alpha, const blas_complex_double x[], const blas_complex_double y[], blas_complex_double a[]){
+	cblas_zgeru(CblasColMajor, m, n, (double*)&alpha, (double*)x, 1, (double*)y, 1, (double*)a, m);
+}
+
+DLLEXPORT void c_conjugate_rank_one_update(const int m, const int n, const blas_complex_float alpha, const blas_complex_float x[], const blas_complex_float y[], blas_complex_float a[]){
+	cblas_cgerc(CblasColMajor, m, n, (float*)&alpha, (float*)x, 1, (float*)y, 1, (float*)a, m);
+}
+
+DLLEXPORT void z_conjugate_rank_one_update(const int m, const int n, const blas_complex_double alpha, const blas_complex_double x[], const blas_complex_double y[], blas_complex_double a[]){
+	cblas_zgerc(CblasColMajor, m, n, (double*)&alpha, (double*)x, 1, (double*)y, 1, (double*)a, m);
+}
+
+DLLEXPORT void s_symmetric_rank_k_update(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int n, const int k, const float alpha, const float a[], const float beta, float c[], const int mirror){
+	const blas_int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_ssyrk(CblasColMajor, uplo, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror)
+	{
+		s_mirror_triangle(uplo == CblasUpper, n, c);
+	}
+}
+
+DLLEXPORT void d_symmetric_rank_k_update(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int n, const int k, const double alpha, const double a[], const double beta, double c[], const int mirror){
+	const blas_int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_dsyrk(CblasColMajor, uplo, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror)
+	{
+		d_mirror_triangle(uplo == CblasUpper, n, c);
+	}
+}
+
+DLLEXPORT void c_hermitian_rank_k_update(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int n, const int k, const float alpha, const blas_complex_float a[], const float beta, blas_complex_float c[], const int mirror){
+	const blas_int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_cherk(CblasColMajor, uplo, trans, n, k, alpha, (float*)a, lda, beta, (float*)c, n);
+
+	if (mirror)
+	{
+		c_mirror_triangle(uplo == CblasUpper, 1, n, c);
+	}
+}
+
+DLLEXPORT void z_hermitian_rank_k_update(CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, const int n, const int k, const double alpha, const blas_complex_double a[], const double beta, blas_complex_double c[], const int mirror){
+	const blas_int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_zherk(CblasColMajor, uplo, trans, n, k, alpha, (double*)a, lda, beta, (double*)c, n);
+
+	if (mirror)
+	{
+		z_mirror_triangle(uplo == CblasUpper, 1, n, c);
+	}
+}
+
+DLLEXPORT void s_triangular_solve(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int m, const int n, const float alpha, const float a[], float b[]){
+	const blas_int lda = side == CblasLeft ? m : n;
+
+	cblas_strsm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+}
+
+DLLEXPORT void d_triangular_solve(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int m, const int n, const double alpha, const double a[], double b[]){
+	const blas_int lda = side == CblasLeft ? m : n;
+
+	cblas_dtrsm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+}
+
+DLLEXPORT void c_triangular_solve(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int m, const int n, const blas_complex_float alpha, const blas_complex_float a[], blas_complex_float b[]){
+	const blas_int lda = side == CblasLeft ? m : n;
+
+	cblas_ctrsm(CblasColMajor, side, uplo, trans, diag, m, n, (float*)&alpha, (float*)a, lda, (float*)b, m);
+}
+
+DLLEXPORT void z_triangular_solve(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int m, const int n, const blas_complex_double alpha, const blas_complex_double a[], blas_complex_double b[]){
+	const blas_int lda = side == CblasLeft ? m : n;
+
+	cblas_ztrsm(CblasColMajor, side, uplo, trans, diag, m, n, (double*)&alpha, (double*)a, lda, (double*)b, m);
+}
+
+DLLEXPORT void s_triangular_multiply(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int m, const int n, const float alpha, const float a[], float b[]){
+	const blas_int lda = side == CblasLeft ? m : n;
+
+	cblas_strmm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+}
+
+DLLEXPORT void d_triangular_multiply(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int m, const int n, const double alpha, const double a[], double b[]){
+	const blas_int lda = side == CblasLeft ? m : n;
+
+	cblas_dtrmm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+}
+
+DLLEXPORT void c_triangular_multiply(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int m, const int n, const blas_complex_float alpha, const blas_complex_float a[], blas_complex_float b[]){
+	const blas_int lda = side == CblasLeft ? m : n;
+
+	cblas_ctrmm(CblasColMajor, side, uplo, trans, diag, m, n, (float*)&alpha, (float*)a, lda, (float*)b, m);
+}
+
+DLLEXPORT void z_triangular_multiply(CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, const int m, const int n, const blas_complex_double alpha, const blas_complex_double a[], blas_complex_double b[]){
+	const blas_int lda = side == CblasLeft ? m : n;
+
+	cblas_ztrmm(CblasColMajor, side, uplo, trans, diag, m, n, (double*)&alpha, (double*)a, lda, (double*)b, m);
+}
+
 #if __cplusplus
 }
 #endif
@@ -0,0 +1,153 @@
+#include "wrapper_common.h"
+#include "blas.h"
+#include "parallel_common.h"
+
+#include <cstddef>
+
+/*
+	Portable batched GEMM for providers without a native batch API (OpenBLAS, ATLAS).
+	The batch is split across threads, each thread running the plain single GEMM
+	on its share, so that many tiny products no longer run one after the other.
+	A BLAS that threads large calls itself defines BLAS_THREADING_THRESHOLD, the
+	m*n*k above which it does: batches of such products run in order, since
+	spreading them as well would oversubscribe the cores.
+*/
+
+// Minimum number of multiply-adds per thread before spreading a batch across cores.
+const long long BATCH_MIN_WORK_PER_THREAD = 1 << 18;
+
+inline blas_int batch_min_chunk(const long long work)
+{
+	return static_cast<blas_int>(std::max(1LL, BATCH_MIN_WORK_PER_THREAD / std::max(1LL, work)));
+}
+
+template<typename Body>
+inline void batch_for(const int batch_size, const blas_int m, const blas_int n, const blas_int k, Body body)
+{
+	const long long work = static_cast<long long>(m) * n * k;
+
+#ifdef BLAS_THREADING_THRESHOLD
+	if (work > BLAS_THREADING_THRESHOLD)
+	{
+		body(static_cast<blas_int>(0), static_cast<blas_int>(std::max(0, batch_size)));
+		return;
+	}
+#endif
+
+	parallel_for(static_cast<blas_int>(batch_size), batch_min_chunk(work), body);
+}
+
+extern "C" {
+
+	DLLEXPORT void s_matrix_multiply_batch(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float* x[], const float* y[], const float beta, float* c[], const int batch_size)
+	{
+		const blas_int lda = transA == CblasNoTrans ? m : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		batch_for(batch_size, m, n, k, [=](blas_int begin, blas_int end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, x[i], lda, y[i], ldb, beta, c[i], m);
+			}
+		});
+	}
+
+	DLLEXPORT void d_matrix_multiply_batch(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double* x[], const double* y[], const double beta, double* c[], const int batch_size)
+	{
+		const blas_int lda = transA == CblasNoTrans ? m : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		batch_for(batch_size, m, n, k, [=](blas_int begin, blas_int end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, x[i], lda, y[i], ldb, beta, c[i], m);
+			}
+		});
+	}
+
+	DLLEXPORT void c_matrix_multiply_batch(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_float alpha, const blas_complex_float* x[], const blas_complex_float* y[], const blas_complex_float beta, blas_complex_float* c[], const int batch_size)
+	{
+		const blas_int lda = transA == CblasNoTrans ? m : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		batch_for(batch_size, m, n, k, [=](blas_int begin, blas_int end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				cblas_cgemm(CblasColMajor, transA, transB, m, n, k, (float*)&alpha, (float*)x[i], lda, (float*)y[i], ldb, (float*)&beta, (float*)c[i], m);
+			}
+		});
+	}
+
+	DLLEXPORT void z_matrix_multiply_batch(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_double alpha, const blas_complex_double* x[], const blas_complex_double* y[], const blas_complex_double beta, blas_complex_double* c[], const int batch_size)
+	{
+		const blas_int lda = transA == CblasNoTrans ? m : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		batch_for(batch_size, m, n, k, [=](blas_int begin, blas_int end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				cblas_zgemm(CblasColMajor, transA, transB, m, n, k, (double*)&alpha, (double*)x[i], lda, (double*)y[i], ldb, (double*)&beta, (double*)c[i], m);
+			}
+		});
+	}
+
+	DLLEXPORT void s_matrix_multiply_batch_strided(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float x[], const int xStride, const float y[], const int yStride, const float beta, float c[], const int cStride, const int batch_size)
+	{
+		const blas_int lda = transA == CblasNoTrans ? m : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		batch_for(batch_size, m, n, k, [=](blas_int begin, blas_int end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + static_cast<std::ptrdiff_t>(i) * xStride, lda, y + static_cast<std::ptrdiff_t>(i) * yStride, ldb, beta, c + static_cast<std::ptrdiff_t>(i) * cStride, m);
+			}
+		});
+	}
+
+	DLLEXPORT void d_matrix_multiply_batch_strided(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double x[], const int xStride, const double y[], const int yStride, const double beta, double c[], const int cStride, const int batch_size)
+	{
+		const blas_int lda = transA == CblasNoTrans ? m : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		batch_for(batch_size, m, n, k, [=](blas_int begin, blas_int end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + static_cast<std::ptrdiff_t>(i) * xStride, lda, y + static_cast<std::ptrdiff_t>(i) * yStride, ldb, beta, c + static_cast<std::ptrdiff_t>(i) * cStride, m);
+			}
+		});
+	}
+
+	DLLEXPORT void c_matrix_multiply_batch_strided(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_float alpha, const blas_complex_float x[], const int xStride, const blas_complex_float y[], const int yStride, const blas_complex_float beta, blas_complex_float c[], const int cStride, const int batch_size)
+	{
+		const blas_int lda = transA == CblasNoTrans ? m : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		batch_for(batch_size, m, n, k, [=](blas_int begin, blas_int end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				cblas_cgemm(CblasColMajor, transA, transB, m, n, k, (float*)&alpha, (float*)(x + static_cast<std::ptrdiff_t>(i) * xStride), lda, (float*)(y + static_cast<std::ptrdiff_t>(i) * yStride), ldb, (float*)&beta, (float*)(c + static_cast<std::ptrdiff_t>(i) * cStride), m);
+			}
+		});
+	}
+
+	DLLEXPORT void z_matrix_multiply_batch_strided(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_double alpha, const blas_complex_double x[], const int xStride, const blas_complex_double y[], const int yStride, const blas_complex_double beta, blas_complex_double c[], const int cStride, const int batch_size)
+	{
+		const blas_int lda = transA == CblasNoTrans ? m : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		batch_for(batch_size, m, n, k, [=](blas_int begin, blas_int end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				cblas_zgemm(CblasColMajor, transA, transB, m, n, k, (double*)&alpha, (double*)(x + static_cast<std::ptrdiff_t>(i) * xStride), lda, (double*)(y + static_cast<std::ptrdiff_t>(i) * yStride), ldb, (double*)&beta, (double*)(c + static_cast<std::ptrdiff_t>(i) * cStride), m);
+			}
+		});
+	}
+}
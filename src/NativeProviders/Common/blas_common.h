@@ -0,0 +1,128 @@
+#ifndef BLAS_COMMON_H
+#define BLAS_COMMON_H
+
+/*
+	Helpers shared by the C and C++ BLAS wrappers. Must stay valid C as well as C++,
+	and only rely on the blas_int/blas_complex_* types of the provider's blas.h.
+	Complex values are accessed as interleaved real/imaginary pairs since the
+	provider complex types differ in layout naming (and are C99 complex in some builds).
+*/
+
+/* Tile size of the cache-blocked triangle mirroring. */
+#define MIRROR_BLOCK 32
+
+/* A product op(x)*op(y) is Hermitian when exactly one operand is conjugate-transposed (e.g. x^H*x); only then is it mirrored conjugated. */
+#define HERMITIAN_PRODUCT(transA, transB) (((transA) == CblasConjTrans) != ((transB) == CblasConjTrans))
+
+/* Whether the complex scalars alpha and beta (of real type R) are real; alpha*x*x^H + beta*C is only Hermitian then. */
+#define REAL_SCALARS(R, alpha, beta) (((const R*)&(alpha))[1] == (R)0 && ((const R*)&(beta))[1] == (R)0)
+
+/*
+	Copies the computed triangle of the column-major n x n matrix a into the other triangle.
+	upper != 0 means the upper triangle holds the data.
+*/
+static void s_mirror_triangle(const int upper, const blas_int n, float a[])
+{
+	blas_int ib, jb, i, j, imax, jmax;
+	for (jb = 0; jb < n; jb += MIRROR_BLOCK)
+	{
+		jmax = jb + MIRROR_BLOCK < n ? jb + MIRROR_BLOCK : n;
+		for (ib = 0; ib <= jb; ib += MIRROR_BLOCK)
+		{
+			imax = ib + MIRROR_BLOCK < n ? ib + MIRROR_BLOCK : n;
+			for (j = jb; j < jmax; ++j)
+			{
+				for (i = ib; i < imax && i < j; ++i)
+				{
+					if (upper) a[j + i * n] = a[i + j * n];
+					else a[i + j * n] = a[j + i * n];
+				}
+			}
+		}
+	}
+}
+
+static void d_mirror_triangle(const int upper, const blas_int n, double a[])
+{
+	blas_int ib, jb, i, j, imax, jmax;
+	for (jb = 0; jb < n; jb += MIRROR_BLOCK)
+	{
+		jmax = jb + MIRROR_BLOCK < n ? jb + MIRROR_BLOCK : n;
+		for (ib = 0; ib <= jb; ib += MIRROR_BLOCK)
+		{
+			imax = ib + MIRROR_BLOCK < n ? ib + MIRROR_BLOCK : n;
+			for (j = jb; j < jmax; ++j)
+			{
+				for (i = ib; i < imax && i < j; ++i)
+				{
+					if (upper) a[j + i * n] = a[i + j * n];
+					else a[i + j * n] = a[j + i * n];
+				}
+			}
+		}
+	}
+}
+
+/*
+	conjugate != 0 mirrors as Hermitian (conjugating the copied values) and zeroes the imaginary part of the diagonal;
+	otherwise the values are copied as they are and the diagonal is left alone.
+*/
+static void c_mirror_triangle(const int upper, const int conjugate, const blas_int n, blas_complex_float a[])
+{
+	float* v = (float*)a;
+	const float sign = conjugate ? -1.0f : 1.0f;
+	blas_int ib, jb, i, j, imax, jmax, src, dst;
+	for (jb = 0; jb < n; jb += MIRROR_BLOCK)
+	{
+		jmax = jb + MIRROR_BLOCK < n ? jb + MIRROR_BLOCK : n;
+		for (ib = 0; ib <= jb; ib += MIRROR_BLOCK)
+		{
+			imax = ib + MIRROR_BLOCK < n ? ib + MIRROR_BLOCK : n;
+			for (j = jb; j < jmax; ++j)
+			{
+				for (i = ib; i < imax && i < j; ++i)
+				{
+					src = upper ? 2 * (i + j * n) : 2 * (j + i * n);
+					dst = upper ? 2 * (j + i * n) : 2 * (i + j * n);
+					v[dst] = v[src];
+					v[dst + 1] = sign * v[src + 1];
+				}
+			}
+		}
+	}
+	if (conjugate)
+	{
+		for (i = 0; i < n; ++i) v[2 * (i + i * n) + 1] = 0.0f;
+	}
+}
+
+static void z_mirror_triangle(const int upper, const int conjugate, const blas_int n, blas_complex_double a[])
+{
+	double* v = (double*)a;
+	const double sign = conjugate ? -1.0 : 1.0;
+	blas_int ib, jb, i, j, imax, jmax, src, dst;
+	for (jb = 0; jb < n; jb += MIRROR_BLOCK)
+	{
+		jmax = jb + MIRROR_BLOCK < n ? jb + MIRROR_BLOCK : n;
+		for (ib = 0; ib <= jb; ib += MIRROR_BLOCK)
+		{
+			imax = ib + MIRROR_BLOCK < n ? ib + MIRROR_BLOCK : n;
+			for (j = jb; j < jmax; ++j)
+			{
+				for (i = ib; i < imax && i < j; ++i)
+				{
+					src = upper ? 2 * (i + j * n) : 2 * (j + i * n);
+					dst = upper ? 2 * (j + i * n) : 2 * (i + j * n);
+					v[dst] = v[src];
+					v[dst + 1] = sign * v[src + 1];
+				}
+			}
+		}
+	}
+	if (conjugate)
+	{
+		for (i = 0; i < n; ++i) v[2 * (i + i * n) + 1] = 0.0;
+	}
+}
+
+#endif
@@ -0,0 +1,246 @@
+#include "wrapper_common.h"
+#include "blas.h"
+#include "blas_common.h"
+
+#include <cmath>
+#include <complex>
+
+/*
+	Portable implementations of BLAS extensions that MKL provides natively (see MKL/blas_extensions.c),
+	for the providers that lack them (OpenBLAS, ATLAS).
+*/
+
+// Diagonal blocks up to this size are computed column by column.
+const blas_int TRIANGLE_MIN_BLOCK = 16;
+
+/*
+	Computes one triangle of C = alpha*op(x)*op(y) + beta*C (gemmt) by recursively splitting it
+	into two smaller triangles and one rectangle, which is handed to the regular GEMM.
+	gemm(rows, cols, x, y, c) must compute the rows x cols block starting at the given operand positions.
+*/
+template<typename T, typename GEMM>
+inline void matrix_multiply_triangle(const bool upper, const CBLAS_TRANSPOSE transA, const CBLAS_TRANSPOSE transB, const blas_int n, const blas_int k,
+	const blas_int begin, const blas_int end, const T x[], const T y[], T c[], GEMM gemm)
+{
+	// row r of op(x) and column j of op(y)
+	auto x_row = [=](blas_int r) { return transA == CblasNoTrans ? x + r : x + r * k; };
+	auto y_col = [=](blas_int j) { return transB == CblasNoTrans ? y + j * k : y + j; };
+
+	if (end - begin <= TRIANGLE_MIN_BLOCK)
+	{
+		for (auto j = begin; j < end; ++j)
+		{
+			if (upper)
+			{
+				gemm(j - begin + 1, 1, x_row(begin), y_col(j), c + begin + j * n);
+			}
+			else
+			{
+				gemm(end - j, 1, x_row(j), y_col(j), c + j + j * n);
+			}
+		}
+
+		return;
+	}
+
+	const auto half = begin + (end - begin) / 2;
+
+	matrix_multiply_triangle(upper, transA, transB, n, k, begin, half, x, y, c, gemm);
+
+	if (upper)
+	{
+		gemm(half - begin, end - half, x_row(begin), y_col(half), c + begin + half * n);
+	}
+	else
+	{
+		gemm(end - half, half - begin, x_row(half), y_col(begin), c + half + begin * n);
+	}
+
+	matrix_multiply_triangle(upper, transA, transB, n, k, half, end, x, y, c, gemm);
+}
+
+// y = alpha*x + beta*y in a single pass over memory.
+template<typename T>
+inline void axpby(const blas_int n, const T alpha, const T x[], const T beta, T y[])
+{
+	for (blas_int i = 0; i < n; ++i)
+	{
+		y[i] = alpha * x[i] + beta * y[i];
+	}
+}
+
+// Zero-based index of the first element with the smallest magnitude, measured as |re| + |im| for complex values like i?amax.
+template<typename T, typename MAGNITUDE>
+inline blas_int min_abs_index(const blas_int n, const T x[], MAGNITUDE magnitude)
+{
+	blas_int index = 0;
+	if (n <= 0)
+	{
+		return index;
+	}
+
+	auto min = magnitude(x[0]);
+	for (blas_int i = 1; i < n; ++i)
+	{
+		const auto value = magnitude(x[i]);
+		if (value < min)
+		{
+			min = value;
+			index = i;
+		}
+	}
+
+	return index;
+}
+
+// Complex Givens rotation as in the reference BLAS crotg/zrotg.
+template<typename R>
+inline void complex_rotate_generate(std::complex<R>& a, const std::complex<R> b, R& c, std::complex<R>& s)
+{
+	const auto abs_a = std::abs(a);
+	if (abs_a == R(0))
+	{
+		c = R(0);
+		s = std::complex<R>(R(1), R(0));
+		a = b;
+		return;
+	}
+
+	const auto scale = abs_a + std::abs(b);
+	const auto norm = scale * std::sqrt(std::norm(a / scale) + std::norm(b / scale));
+	const auto alpha = a / abs_a;
+	c = abs_a / norm;
+	s = alpha * std::conj(b) / norm;
+	a = alpha * norm;
+}
+
+extern "C" {
+
+	DLLEXPORT void s_matrix_multiply_triangle(CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int n, const int k, const float alpha, const float x[], const float y[], const float beta, float c[], const int mirror)
+	{
+		const blas_int lda = transA == CblasNoTrans ? n : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		matrix_multiply_triangle(uplo == CblasUpper, transA, transB, n, k, 0, n, x, y, c, [=](blas_int rows, blas_int cols, const float* a, const float* b, float* block)
+		{
+			cblas_sgemm(CblasColMajor, transA, transB, rows, cols, k, alpha, a, lda, b, ldb, beta, block, n);
+		});
+
+		if (mirror)
+		{
+			s_mirror_triangle(uplo == CblasUpper, n, c);
+		}
+	}
+
+	DLLEXPORT void d_matrix_multiply_triangle(CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int n, const int k, const double alpha, const double x[], const double y[], const double beta, double c[], const int mirror)
+	{
+		const blas_int lda = transA == CblasNoTrans ? n : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		matrix_multiply_triangle(uplo == CblasUpper, transA, transB, n, k, 0, n, x, y, c, [=](blas_int rows, blas_int cols, const double* a, const double* b, double* block)
+		{
+			cblas_dgemm(CblasColMajor, transA, transB, rows, cols, k, alpha, a, lda, b, ldb, beta, block, n);
+		});
+
+		if (mirror)
+		{
+			d_mirror_triangle(uplo == CblasUpper, n, c);
+		}
+	}
+
+	DLLEXPORT void c_matrix_multiply_triangle(CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int n, const int k, const blas_complex_float alpha, const blas_complex_float x[], const blas_complex_float y[], const blas_complex_float beta, blas_complex_float c[], const int mirror)
+	{
+		const blas_int lda = transA == CblasNoTrans ? n : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		// A Hermitian product with complex alpha or beta has no triangle to mirror: compute it in full.
+		if (mirror && HERMITIAN_PRODUCT(transA, transB) && !REAL_SCALARS(float, alpha, beta))
+		{
+			cblas_cgemm(CblasColMajor, transA, transB, n, n, k, (float*)&alpha, (float*)x, lda, (float*)y, ldb, (float*)&beta, (float*)c, n);
+			return;
+		}
+
+		matrix_multiply_triangle(uplo == CblasUpper, transA, transB, n, k, 0, n, x, y, c, [=](blas_int rows, blas_int cols, const blas_complex_float* a, const blas_complex_float* b, blas_complex_float* block)
+		{
+			cblas_cgemm(CblasColMajor, transA, transB, rows, cols, k, (float*)&alpha, (float*)a, lda, (float*)b, ldb, (float*)&beta, (float*)block, n);
+		});
+
+		if (mirror)
+		{
+			c_mirror_triangle(uplo == CblasUpper, HERMITIAN_PRODUCT(transA, transB), n, c);
+		}
+	}
+
+	DLLEXPORT void z_matrix_multiply_triangle(CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int n, const int k, const blas_complex_double alpha, const blas_complex_double x[], const blas_complex_double y[], const blas_complex_double beta, blas_complex_double c[], const int mirror)
+	{
+		const blas_int lda = transA == CblasNoTrans ? n : k;
+		const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+		// A Hermitian product with complex alpha or beta has no triangle to mirror: compute it in full.
+		if (mirror && HERMITIAN_PRODUCT(transA, transB) && !REAL_SCALARS(double, alpha, beta))
+		{
+			cblas_zgemm(CblasColMajor, transA, transB, n, n, k, (double*)&alpha, (double*)x, lda, (double*)y, ldb, (double*)&beta, (double*)c, n);
+			return;
+		}
+
+		matrix_multiply_triangle(uplo == CblasUpper, transA, transB, n, k, 0, n, x, y, c, [=](blas_int rows, blas_int cols, const blas_complex_double* a, const blas_complex_double* b, blas_complex_double* block)
+		{
+			cblas_zgemm(CblasColMajor, transA, transB, rows, cols, k, (double*)&alpha, (double*)a, lda, (double*)b, ldb, (double*)&beta, (double*)block, n);
+		});
+
+		if (mirror)
+		{
+			z_mirror_triangle(uplo == CblasUpper, HERMITIAN_PRODUCT(transA, transB), n, c);
+		}
+	}
+
+	DLLEXPORT void s_axpby(const int n, const float alpha, const float x[], const float beta, float y[])
+	{
+		axpby(n, alpha, x, beta, y);
+	}
+
+	DLLEXPORT void d_axpby(const int n, const double alpha, const double x[], const double beta, double y[])
+	{
+		axpby(n, alpha, x, beta, y);
+	}
+
+	DLLEXPORT void c_axpby(const int n, const blas_complex_float alpha, const blas_complex_float x[], const blas_complex_float beta, blas_complex_float y[])
+	{
+		axpby(n, reinterpret_cast<const std::complex<float>&>(alpha), reinterpret_cast<const std::complex<float>*>(x), reinterpret_cast<const std::complex<float>&>(beta), reinterpret_cast<std::complex<float>*>(y));
+	}
+
+	DLLEXPORT void z_axpby(const int n, const blas_complex_double alpha, const blas_complex_double x[], const blas_complex_double beta, blas_complex_double y[])
+	{
+		axpby(n, reinterpret_cast<const std::complex<double>&>(alpha), reinterpret_cast<const std::complex<double>*>(x), reinterpret_cast<const std::complex<double>&>(beta), reinterpret_cast<std::complex<double>*>(y));
+	}
+
+	DLLEXPORT int s_min_abs_index(const int n, const float x[])
+	{
+		return min_abs_index(n, x, [](float v) { return std::abs(v); });
+	}
+
+	DLLEXPORT int d_min_abs_index(const int n, const double x[])
+	{
+		return min_abs_index(n, x, [](double v) { return std::abs(v); });
+	}
+
+	DLLEXPORT int c_min_abs_index(const int n, const blas_complex_float x[])
+	{
+		return min_abs_index(n, reinterpret_cast<const std::complex<float>*>(x), [](const std::complex<float>& v) { return std::abs(v.real()) + std::abs(v.imag()); });
+	}
+
+	DLLEXPORT int z_min_abs_index(const int n, const blas_complex_double x[])
+	{
+		return min_abs_index(n, reinterpret_cast<const std::complex<double>*>(x), [](const std::complex<double>& v) { return std::abs(v.real()) + std::abs(v.imag()); });
+	}
+
+	DLLEXPORT void c_rotate_generate(blas_complex_float* a, const blas_complex_float* b, float* c, blas_complex_float* s)
+	{
+		complex_rotate_generate(*reinterpret_cast<std::complex<float>*>(a), *reinterpret_cast<const std::complex<float>*>(b), *c, *reinterpret_cast<std::complex<float>*>(s));
+	}
+
+	DLLEXPORT void z_rotate_generate(blas_complex_double* a, const blas_complex_double* b, double* c, blas_complex_double* s)
+	{
+		complex_rotate_generate(*reinterpret_cast<std::complex<double>*>(a), *reinterpret_cast<const std::complex<double>*>(b), *c, *reinterpret_cast<std::complex<double>*>(s));
+	}
+}
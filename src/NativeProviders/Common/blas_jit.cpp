@@ -0,0 +1,226 @@
+#include "wrapper_common.h"
+#include "blas.h"
+
+#include <complex>
+#include <new>
+#include <type_traits>
+
+/*
+	Portable counterpart of the MKL JIT GEMM kernels (see MKL/blas_jit.c) for OpenBLAS and ATLAS.
+
+	A kernel is bound to one (transA, transB, m, n, k, alpha, beta) configuration on creation.
+	For non-transposed A with up to MAX_KERNEL_ROWS rows, the row count is a template parameter so
+	the compiler can keep a whole column of C in registers and fully unroll the inner loop; all
+	other configurations fall back to the provider's GEMM, mirroring MKL_NO_JIT.
+	Status codes follow MKL: 0 specialised kernel, 1 generic fallback, 2 error.
+*/
+
+const int KERNEL_SPECIALISED = 0;
+const int KERNEL_FALLBACK = 1;
+const int KERNEL_ERROR = 2;
+
+const blas_int MAX_KERNEL_ROWS = 16;
+
+template<typename T> struct is_complex : std::false_type {};
+template<typename T> struct is_complex<std::complex<T>> : std::true_type {};
+
+struct gemm_kernel_base
+{
+	virtual ~gemm_kernel_base() {}
+};
+
+template<typename T> struct gemm_kernel;
+template<typename T> using kernel_function = void (*)(const gemm_kernel<T>& kernel, const T* a, const T* b, T* c);
+
+template<typename T>
+struct gemm_kernel : gemm_kernel_base
+{
+	CBLAS_TRANSPOSE transA, transB;
+	blas_int m, n, k, lda, ldb;
+	T alpha, beta;
+	kernel_function<T> execute;
+};
+
+inline void gemm(const gemm_kernel<float>& g, const float* a, const float* b, float* c)
+{
+	cblas_sgemm(CblasColMajor, g.transA, g.transB, g.m, g.n, g.k, g.alpha, a, g.lda, b, g.ldb, g.beta, c, g.m);
+}
+
+inline void gemm(const gemm_kernel<double>& g, const double* a, const double* b, double* c)
+{
+	cblas_dgemm(CblasColMajor, g.transA, g.transB, g.m, g.n, g.k, g.alpha, a, g.lda, b, g.ldb, g.beta, c, g.m);
+}
+
+inline void gemm(const gemm_kernel<std::complex<float>>& g, const std::complex<float>* a, const std::complex<float>* b, std::complex<float>* c)
+{
+	cblas_cgemm(CblasColMajor, g.transA, g.transB, g.m, g.n, g.k, (float*)&g.alpha, (float*)a, g.lda, (float*)b, g.ldb, (float*)&g.beta, (float*)c, g.m);
+}
+
+inline void gemm(const gemm_kernel<std::complex<double>>& g, const std::complex<double>* a, const std::complex<double>* b, std::complex<double>* c)
+{
+	cblas_zgemm(CblasColMajor, g.transA, g.transB, g.m, g.n, g.k, (double*)&g.alpha, (double*)a, g.lda, (double*)b, g.ldb, (double*)&g.beta, (double*)c, g.m);
+}
+
+template<typename T>
+void execute_fallback(const gemm_kernel<T>& g, const T* a, const T* b, T* c)
+{
+	gemm(g, a, b, c);
+}
+
+// C(MxN) = alpha*A(MxK)*op(B) + beta*C with op(B) either B or B^T, all packed column-major.
+template<typename T, int M, bool TransposeB, bool ZeroBeta>
+void execute_specialised(const gemm_kernel<T>& g, const T* a, const T* b, T* c)
+{
+	const blas_int n = g.n;
+	const blas_int k = g.k;
+
+	for (blas_int j = 0; j < n; ++j)
+	{
+		T acc[M] = {};
+
+		for (blas_int l = 0; l < k; ++l)
+		{
+			const T bl = TransposeB ? b[j + l * n] : b[l + j * k];
+			const T* al = a + l * M;
+			for (int i = 0; i < M; ++i)
+			{
+				acc[i] += al[i] * bl;
+			}
+		}
+
+		T* cj = c + j * M;
+		for (int i = 0; i < M; ++i)
+		{
+			cj[i] = ZeroBeta ? g.alpha * acc[i] : g.alpha * acc[i] + g.beta * cj[i];
+		}
+	}
+}
+
+template<typename T, int M>
+inline kernel_function<T> select_rows(const bool transposeB, const bool zeroBeta)
+{
+	if (transposeB)
+	{
+		return zeroBeta ? execute_specialised<T, M, true, true> : execute_specialised<T, M, true, false>;
+	}
+
+	return zeroBeta ? execute_specialised<T, M, false, true> : execute_specialised<T, M, false, false>;
+}
+
+template<typename T>
+inline kernel_function<T> select_kernel(const blas_int m, const bool transposeB, const bool zeroBeta)
+{
+	switch (m)
+	{
+	case 1: return select_rows<T, 1>(transposeB, zeroBeta);
+	case 2: return select_rows<T, 2>(transposeB, zeroBeta);
+	case 3: return select_rows<T, 3>(transposeB, zeroBeta);
+	case 4: return select_rows<T, 4>(transposeB, zeroBeta);
+	case 5: return select_rows<T, 5>(transposeB, zeroBeta);
+	case 6: return select_rows<T, 6>(transposeB, zeroBeta);
+	case 7: return select_rows<T, 7>(transposeB, zeroBeta);
+	case 8: return select_rows<T, 8>(transposeB, zeroBeta);
+	case 9: return select_rows<T, 9>(transposeB, zeroBeta);
+	case 10: return select_rows<T, 10>(transposeB, zeroBeta);
+	case 11: return select_rows<T, 11>(transposeB, zeroBeta);
+	case 12: return select_rows<T, 12>(transposeB, zeroBeta);
+	case 13: return select_rows<T, 13>(transposeB, zeroBeta);
+	case 14: return select_rows<T, 14>(transposeB, zeroBeta);
+	case 15: return select_rows<T, 15>(transposeB, zeroBeta);
+	case 16: return select_rows<T, 16>(transposeB, zeroBeta);
+	default: return nullptr;
+	}
+}
+
+template<typename T>
+inline int kernel_create(gemm_kernel_base** handle, const CBLAS_TRANSPOSE transA, const CBLAS_TRANSPOSE transB, const blas_int m, const blas_int n, const blas_int k, const T alpha, const T beta)
+{
+	*handle = nullptr;
+
+	auto kernel = new (std::nothrow) gemm_kernel<T>();
+	if (!kernel)
+	{
+		return KERNEL_ERROR;
+	}
+
+	kernel->transA = transA;
+	kernel->transB = transB;
+	kernel->m = m;
+	kernel->n = n;
+	kernel->k = k;
+	kernel->lda = transA == CblasNoTrans ? m : k;
+	kernel->ldb = transB == CblasNoTrans ? k : n;
+	kernel->alpha = alpha;
+	kernel->beta = beta;
+	kernel->execute = nullptr;
+
+	// conjugate transposes of B are left to the generic path; for real types it equals the transpose
+	if (transA == CblasNoTrans && m <= MAX_KERNEL_ROWS && (transB != CblasConjTrans || !is_complex<T>::value))
+	{
+		kernel->execute = select_kernel<T>(m, transB != CblasNoTrans, beta == T(0));
+	}
+
+	const int status = kernel->execute ? KERNEL_SPECIALISED : KERNEL_FALLBACK;
+	if (!kernel->execute)
+	{
+		kernel->execute = execute_fallback<T>;
+	}
+
+	*handle = kernel;
+	return status;
+}
+
+template<typename T>
+inline void kernel_execute(const gemm_kernel_base* handle, const T* a, const T* b, T* c)
+{
+	const auto& kernel = *static_cast<const gemm_kernel<T>*>(handle);
+	kernel.execute(kernel, a, b, c);
+}
+
+extern "C" {
+
+	DLLEXPORT int s_matrix_multiply_kernel_create(gemm_kernel_base** handle, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float beta)
+	{
+		return kernel_create<float>(handle, transA, transB, m, n, k, alpha, beta);
+	}
+
+	DLLEXPORT int d_matrix_multiply_kernel_create(gemm_kernel_base** handle, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double beta)
+	{
+		return kernel_create<double>(handle, transA, transB, m, n, k, alpha, beta);
+	}
+
+	DLLEXPORT int c_matrix_multiply_kernel_create(gemm_kernel_base** handle, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_float alpha, const blas_complex_float beta)
+	{
+		return kernel_create<std::complex<float>>(handle, transA, transB, m, n, k, reinterpret_cast<const std::complex<float>&>(alpha), reinterpret_cast<const std::complex<float>&>(beta));
+	}
+
+	DLLEXPORT int z_matrix_multiply_kernel_create(gemm_kernel_base** handle, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_double alpha, const blas_complex_double beta)
+	{
+		return kernel_create<std::complex<double>>(handle, transA, transB, m, n, k, reinterpret_cast<const std::complex<double>&>(alpha), reinterpret_cast<const std::complex<double>&>(beta));
+	}
+
+	DLLEXPORT void s_matrix_multiply_kernel_execute(const gemm_kernel_base* handle, const float x[], const float y[], float c[])
+	{
+		kernel_execute(handle, x, y, c);
+	}
+
+	DLLEXPORT void d_matrix_multiply_kernel_execute(const gemm_kernel_base* handle, const double x[], const double y[], double c[])
+	{
+		kernel_execute(handle, x, y, c);
+	}
+
+	DLLEXPORT void c_matrix_multiply_kernel_execute(const gemm_kernel_base* handle, const blas_complex_float x[], const blas_complex_float y[], blas_complex_float c[])
+	{
+		kernel_execute(handle, reinterpret_cast<const std::complex<float>*>(x), reinterpret_cast<const std::complex<float>*>(y), reinterpret_cast<std::complex<float>*>(c));
+	}
+
+	DLLEXPORT void z_matrix_multiply_kernel_execute(const gemm_kernel_base* handle, const blas_complex_double x[], const blas_complex_double y[], blas_complex_double c[])
+	{
+		kernel_execute(handle, reinterpret_cast<const std::complex<double>*>(x), reinterpret_cast<const std::complex<double>*>(y), reinterpret_cast<std::complex<double>*>(c));
+	}
+
+	DLLEXPORT void x_matrix_multiply_kernel_free(gemm_kernel_base* handle)
+	{
+		delete handle;
+	}
+}
@@ -0,0 +1,113 @@
+#include "wrapper_common.h"
+#include "blas.h"
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+/*
+	Portable counterpart of the MKL packed GEMM (see MKL/blas_pack.c) for OpenBLAS and ATLAS.
+	The packed layout is alpha*op(A) stored contiguously column-major (m x k), so every later
+	product is a plain non-transposed GEMM with alpha = 1 and never touches the caller's A again.
+	Pack returns 0 on success, 1 if out of memory.
+*/
+
+// Tile size of the cache-blocked transposing copy.
+const blas_int PACK_BLOCK = 32;
+
+struct gemm_packed_base
+{
+	virtual ~gemm_packed_base() {}
+};
+
+template<typename T>
+struct gemm_packed : gemm_packed_base
+{
+	blas_int m, k;
+	std::vector<T> data;
+};
+
+template<typename T>
+inline int matrix_multiply_pack(gemm_packed_base** handle, const CBLAS_TRANSPOSE transA, const blas_int m, const blas_int k, const T alpha, const T a[])
+{
+	*handle = nullptr;
+
+	auto packed = new (std::nothrow) gemm_packed<T>();
+	if (!packed)
+	{
+		return 1;
+	}
+
+	try
+	{
+		packed->data.resize(static_cast<size_t>(m) * k);
+	}
+	catch (const std::bad_alloc&)
+	{
+		delete packed;
+		return 1;
+	}
+
+	packed->m = m;
+	packed->k = k;
+	T* dest = packed->data.data();
+
+	if (transA == CblasNoTrans)
+	{
+		std::transform(a, a + static_cast<size_t>(m) * k, dest, [=](T v) { return alpha * v; });
+	}
+	else
+	{
+		// a is k x m column-major; dest(i, l) = alpha * a(l, i)
+		for (blas_int lb = 0; lb < k; lb += PACK_BLOCK)
+		{
+			const auto lmax = std::min(lb + PACK_BLOCK, k);
+			for (blas_int ib = 0; ib < m; ib += PACK_BLOCK)
+			{
+				const auto imax = std::min(ib + PACK_BLOCK, m);
+				for (auto l = lb; l < lmax; ++l)
+				{
+					for (auto i = ib; i < imax; ++i)
+					{
+						dest[i + l * m] = alpha * a[l + i * k];
+					}
+				}
+			}
+		}
+	}
+
+	*handle = packed;
+	return 0;
+}
+
+extern "C" {
+
+	DLLEXPORT int s_matrix_multiply_pack(gemm_packed_base** handle, CBLAS_TRANSPOSE transA, const int m, const int k, const float alpha, const float a[])
+	{
+		return matrix_multiply_pack(handle, transA, m, k, alpha, a);
+	}
+
+	DLLEXPORT int d_matrix_multiply_pack(gemm_packed_base** handle, CBLAS_TRANSPOSE transA, const int m, const int k, const double alpha, const double a[])
+	{
+		return matrix_multiply_pack(handle, transA, m, k, alpha, a);
+	}
+
+	DLLEXPORT void s_matrix_multiply_packed(const gemm_packed_base* handle, CBLAS_TRANSPOSE transB, const int n, const float y[], const float beta, float c[])
+	{
+		const auto& packed = *static_cast<const gemm_packed<float>*>(handle);
+		const blas_int ldb = transB == CblasNoTrans ? packed.k : n;
+		cblas_sgemm(CblasColMajor, CblasNoTrans, transB, packed.m, n, packed.k, 1.0f, packed.data.data(), packed.m, y, ldb, beta, c, packed.m);
+	}
+
+	DLLEXPORT void d_matrix_multiply_packed(const gemm_packed_base* handle, CBLAS_TRANSPOSE transB, const int n, const double y[], const double beta, double c[])
+	{
+		const auto& packed = *static_cast<const gemm_packed<double>*>(handle);
+		const blas_int ldb = transB == CblasNoTrans ? packed.k : n;
+		cblas_dgemm(CblasColMajor, CblasNoTrans, transB, packed.m, n, packed.k, 1.0, packed.data.data(), packed.m, y, ldb, beta, c, packed.m);
+	}
+
+	DLLEXPORT void x_matrix_multiply_pack_free(gemm_packed_base* handle)
+	{
+		delete handle;
+	}
+}
@@ -0,0 +1,270 @@
+#include "wrapper_common.h"
+#include "blas.h"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <new>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TRANSPOSE_SSE2
+#include <emmintrin.h>
+#endif
+
+/*
+	Portable counterpart of the MKL scaled transpose (see MKL/blas_transpose.c) for OpenBLAS and ATLAS.
+	The matrix is walked in TRANSPOSE_BLOCK x TRANSPOSE_BLOCK tiles so that both the source columns
+	and the destination columns of a tile stay in cache; within a tile, real values are transposed
+	in 4x4 (float) or 2x2 (double) SSE2 register blocks. Complex values use the scalar path.
+	The in-place variant returns 0 on success, 1 if the temporary buffer needed for a
+	non-square transpose could not be allocated.
+*/
+
+// Tile edge length of the cache blocking.
+const blas_int TRANSPOSE_BLOCK = 32;
+
+template<typename T>
+inline T conjugate(const T& value)
+{
+	return value;
+}
+
+template<typename T>
+inline std::complex<T> conjugate(const std::complex<T>& value)
+{
+	return std::conj(value);
+}
+
+// Writes alpha*op(a) of a size x size register block into b.
+template<typename T, bool Conjugate>
+struct scalar_kernel
+{
+	static const blas_int size = 1;
+
+	static void apply(const T* a, const blas_int, T* b, const blas_int, const T alpha)
+	{
+		*b = alpha * (Conjugate ? conjugate(*a) : *a);
+	}
+};
+
+template<typename T, bool Conjugate>
+struct transpose_kernel : scalar_kernel<T, Conjugate>
+{
+};
+
+#ifdef TRANSPOSE_SSE2
+template<bool Conjugate>
+struct transpose_kernel<float, Conjugate>
+{
+	static const blas_int size = 4;
+
+	static void apply(const float* a, const blas_int lda, float* b, const blas_int ldb, const float alpha)
+	{
+		const __m128 scale = _mm_set1_ps(alpha);
+		__m128 c0 = _mm_loadu_ps(a);
+		__m128 c1 = _mm_loadu_ps(a + lda);
+		__m128 c2 = _mm_loadu_ps(a + 2 * lda);
+		__m128 c3 = _mm_loadu_ps(a + 3 * lda);
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		_mm_storeu_ps(b, _mm_mul_ps(c0, scale));
+		_mm_storeu_ps(b + ldb, _mm_mul_ps(c1, scale));
+		_mm_storeu_ps(b + 2 * ldb, _mm_mul_ps(c2, scale));
+		_mm_storeu_ps(b + 3 * ldb, _mm_mul_ps(c3, scale));
+	}
+};
+
+template<bool Conjugate>
+struct transpose_kernel<double, Conjugate>
+{
+	static const blas_int size = 2;
+
+	static void apply(const double* a, const blas_int lda, double* b, const blas_int ldb, const double alpha)
+	{
+		const __m128d scale = _mm_set1_pd(alpha);
+		const __m128d c0 = _mm_loadu_pd(a);
+		const __m128d c1 = _mm_loadu_pd(a + lda);
+		_mm_storeu_pd(b, _mm_mul_pd(_mm_unpacklo_pd(c0, c1), scale));
+		_mm_storeu_pd(b + ldb, _mm_mul_pd(_mm_unpackhi_pd(c0, c1), scale));
+	}
+};
+#endif
+
+/*
+	b = alpha*op(a) for the rows x cols block of a (leading dimension lda), written
+	transposed into b (leading dimension ldb).
+*/
+template<typename T, bool Conjugate>
+inline void transpose_tile(const blas_int rows, const blas_int cols, const T alpha, const T* a, const blas_int lda, T* b, const blas_int ldb)
+{
+	typedef transpose_kernel<T, Conjugate> kernel;
+	typedef scalar_kernel<T, Conjugate> scalar;
+	const blas_int k = kernel::size;
+	const blas_int rows_k = rows - rows % k;
+	const blas_int cols_k = cols - cols % k;
+
+	for (blas_int j = 0; j < cols_k; j += k)
+	{
+		for (blas_int i = 0; i < rows_k; i += k)
+		{
+			kernel::apply(a + i + j * lda, lda, b + j + i * ldb, ldb, alpha);
+		}
+	}
+
+	for (blas_int j = 0; j < cols; ++j)
+	{
+		for (blas_int i = j < cols_k ? rows_k : 0; i < rows; ++i)
+		{
+			scalar::apply(a + i + j * lda, lda, b + j + i * ldb, ldb, alpha);
+		}
+	}
+}
+
+template<typename T, bool Conjugate>
+inline void transpose_blocked(const blas_int rows, const blas_int cols, const T alpha, const T* a, const blas_int lda, T* b, const blas_int ldb)
+{
+	for (blas_int jb = 0; jb < cols; jb += TRANSPOSE_BLOCK)
+	{
+		const auto nj = std::min(TRANSPOSE_BLOCK, cols - jb);
+		for (blas_int ib = 0; ib < rows; ib += TRANSPOSE_BLOCK)
+		{
+			const auto ni = std::min(TRANSPOSE_BLOCK, rows - ib);
+			transpose_tile<T, Conjugate>(ni, nj, alpha, a + ib + jb * lda, lda, b + jb + ib * ldb, ldb);
+		}
+	}
+}
+
+// Square in-place transpose: tiles are exchanged pairwise across the diagonal through a stack buffer.
+template<typename T, bool Conjugate>
+inline void transpose_square_inplace(const blas_int n, const T alpha, T* ab)
+{
+	T tile[TRANSPOSE_BLOCK * TRANSPOSE_BLOCK];
+
+	for (blas_int jb = 0; jb < n; jb += TRANSPOSE_BLOCK)
+	{
+		const auto nj = std::min(TRANSPOSE_BLOCK, n - jb);
+		for (blas_int ib = 0; ib <= jb; ib += TRANSPOSE_BLOCK)
+		{
+			const auto ni = std::min(TRANSPOSE_BLOCK, n - ib);
+			T* upper = ab + ib + jb * n;
+			T* lower = ab + jb + ib * n;
+
+			// tile = op(upper)^T, upper = op(lower)^T, lower = tile
+			transpose_tile<T, Conjugate>(ni, nj, alpha, upper, n, tile, TRANSPOSE_BLOCK);
+			if (ib != jb)
+			{
+				transpose_tile<T, Conjugate>(nj, ni, alpha, lower, n, upper, n);
+			}
+
+			for (blas_int i = 0; i < ni; ++i)
+			{
+				memcpy(lower + i * n, tile + i * TRANSPOSE_BLOCK, nj * sizeof(T));
+			}
+		}
+	}
+}
+
+template<typename T>
+inline void scale_copy(const blas_int rows, const blas_int cols, const T alpha, const T* a, T* b)
+{
+	const size_t size = static_cast<size_t>(rows) * cols;
+	for (size_t i = 0; i < size; ++i)
+	{
+		b[i] = alpha * a[i];
+	}
+}
+
+template<typename T>
+inline void transpose(const CBLAS_TRANSPOSE trans, const blas_int rows, const blas_int cols, const T alpha, const T* a, T* b)
+{
+	switch (trans)
+	{
+	case CblasTrans:
+		transpose_blocked<T, false>(rows, cols, alpha, a, rows, b, cols);
+		break;
+	case CblasConjTrans:
+		transpose_blocked<T, true>(rows, cols, alpha, a, rows, b, cols);
+		break;
+	default:
+		scale_copy(rows, cols, alpha, a, b);
+		break;
+	}
+}
+
+template<typename T>
+inline int transpose_inplace(const CBLAS_TRANSPOSE trans, const blas_int rows, const blas_int cols, const T alpha, T* ab)
+{
+	if (trans == CblasNoTrans)
+	{
+		scale_copy(rows, cols, alpha, ab, ab);
+		return 0;
+	}
+
+	if (rows == cols)
+	{
+		if (trans == CblasConjTrans)
+		{
+			transpose_square_inplace<T, true>(rows, alpha, ab);
+		}
+		else
+		{
+			transpose_square_inplace<T, false>(rows, alpha, ab);
+		}
+
+		return 0;
+	}
+
+	const size_t size = static_cast<size_t>(rows) * cols;
+	T* buffer = new (std::nothrow) T[size];
+	if (!buffer)
+	{
+		return 1;
+	}
+
+	memcpy(buffer, ab, size * sizeof(T));
+	transpose(trans, rows, cols, alpha, buffer, ab);
+	delete[] buffer;
+	return 0;
+}
+
+extern "C" {
+
+	DLLEXPORT void s_transpose(CBLAS_TRANSPOSE trans, const int rows, const int cols, const float alpha, const float a[], float b[])
+	{
+		transpose(trans, rows, cols, alpha, a, b);
+	}
+
+	DLLEXPORT void d_transpose(CBLAS_TRANSPOSE trans, const int rows, const int cols, const double alpha, const double a[], double b[])
+	{
+		transpose(trans, rows, cols, alpha, a, b);
+	}
+
+	DLLEXPORT void c_transpose(CBLAS_TRANSPOSE trans, const int rows, const int cols, const blas_complex_float alpha, const blas_complex_float a[], blas_complex_float b[])
+	{
+		transpose(trans, rows, cols, reinterpret_cast<const std::complex<float>&>(alpha), reinterpret_cast<const std::complex<float>*>(a), reinterpret_cast<std::complex<float>*>(b));
+	}
+
+	DLLEXPORT void z_transpose(CBLAS_TRANSPOSE trans, const int rows, const int cols, const blas_complex_double alpha, const blas_complex_double a[], blas_complex_double b[])
+	{
+		transpose(trans, rows, cols, reinterpret_cast<const std::complex<double>&>(alpha), reinterpret_cast<const std::complex<double>*>(a), reinterpret_cast<std::complex<double>*>(b));
+	}
+
+	DLLEXPORT int s_transpose_inplace(CBLAS_TRANSPOSE trans, const int rows, const int cols, const float alpha, float ab[])
+	{
+		return transpose_inplace(trans, rows, cols, alpha, ab);
+	}
+
+	DLLEXPORT int d_transpose_inplace(CBLAS_TRANSPOSE trans, const int rows, const int cols, const double alpha, double ab[])
+	{
+		return transpose_inplace(trans, rows, cols, alpha, ab);
+	}
+
+	DLLEXPORT int c_transpose_inplace(CBLAS_TRANSPOSE trans, const int rows, const int cols, const blas_complex_float alpha, blas_complex_float ab[])
+	{
+		return transpose_inplace(trans, rows, cols, reinterpret_cast<const std::complex<float>&>(alpha), reinterpret_cast<std::complex<float>*>(ab));
+	}
+
+	DLLEXPORT int z_transpose_inplace(CBLAS_TRANSPOSE trans, const int rows, const int cols, const blas_complex_double alpha, blas_complex_double ab[])
+	{
+		return transpose_inplace(trans, rows, cols, reinterpret_cast<const std::complex<double>&>(alpha), reinterpret_cast<std::complex<double>*>(ab));
+	}
+}
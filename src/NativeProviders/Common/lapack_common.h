@@ -1,9 +1,17 @@
 #pragma once
 
+#include <cstddef>
 #include <cstring>
 
 const int INSUFFICIENT_MEMORY = -999999;
 
+// Index type of the LAPACK interface: lapack_int where LAPACKE is used (64-bit in ILP64 builds), int otherwise (ATLAS, CUDA).
+#ifdef lapack_int
+typedef lapack_int lapack_index;
+#else
+typedef int lapack_index;
+#endif
+
 #ifndef LAPACK_MEMORY
 #define LAPACK_MEMORY
 #include <memory>
@@ -11,53 +19,77 @@ const int INSUFFICIENT_MEMORY = -999999;
 template <typename T> using array_ptr = std::unique_ptr<T[]>;
 
 template<typename T>
-inline array_ptr<T> array_new(const int size)
+inline array_ptr<T> array_new(const size_t size)
 {
 	return array_ptr<T>(new T[size]);
 }
 
 #endif
 
+// Element count of an m x n matrix, evaluated in size_t so it cannot overflow a 32-bit index.
+inline size_t matrix_size(const lapack_index m, const lapack_index n)
+{
+	return static_cast<size_t>(m) * static_cast<size_t>(n);
+}
+
 template<typename T>
-inline array_ptr<T> array_clone(const int size, const T* array)
+inline array_ptr<T> array_clone(const size_t size, const T* array)
 {
 	auto clone = array_new<T>(size);
 	memcpy(clone.get(), array, size * sizeof(T));
 	return clone;
 }
 
-inline void shift_ipiv_down(int m, int ipiv[])
+inline void shift_ipiv_down(lapack_index m, lapack_index ipiv[])
 {
-	for(auto i = 0; i < m; ++i )
+	for(lapack_index i = 0; i < m; ++i )
 	{
 		ipiv[i] -= 1;
 	}
 }
 
-inline void shift_ipiv_up(int m, int ipiv[])
+inline void shift_ipiv_up(lapack_index m, lapack_index ipiv[])
 {
-	for(auto i = 0; i < m; ++i )
+	for(lapack_index i = 0; i < m; ++i )
 	{
 		ipiv[i] += 1;
 	}
 }
 
+// Copies 1-based LAPACK pivots into the caller's 0-based 32-bit pivots; the exported ABI is int even in ILP64 builds.
+inline void pivots_to_int(lapack_index m, const lapack_index pivots[], int ipiv[])
+{
+	for (lapack_index i = 0; i < m; ++i)
+	{
+		ipiv[i] = static_cast<int>(pivots[i] - 1);
+	}
+}
+
+// Copies the caller's 0-based 32-bit pivots into 1-based LAPACK pivots.
+inline void pivots_from_int(lapack_index m, const int ipiv[], lapack_index pivots[])
+{
+	for (lapack_index i = 0; i < m; ++i)
+	{
+		pivots[i] = static_cast<lapack_index>(ipiv[i]) + 1;
+	}
+}
+
 template<typename T>
-inline T* Clone(const int m, const int n, const T* a)
+inline T* Clone(const lapack_index m, const lapack_index n, const T* a)
 {
-	auto clone = new T[m*n];
-	memcpy(clone, a, m*n*sizeof(T));
+	auto clone = new T[matrix_size(m, n)];
+	memcpy(clone, a, matrix_size(m, n)*sizeof(T));
 	return clone;
 }
 
 template<typename T>
-inline void copyBtoX (int m, int n, int bn, T b[], T x[])
+inline void copyBtoX (lapack_index m, lapack_index n, lapack_index bn, T b[], T x[])
 {
-	for (auto i = 0; i < n; ++i)
+	for (lapack_index i = 0; i < n; ++i)
 	{
-		for (auto j = 0; j < bn; ++j)
+		for (lapack_index j = 0; j < bn; ++j)
 		{
-			x[j * n + i] = b[j * m + i];
+			x[static_cast<size_t>(j) * n + i] = b[static_cast<size_t>(j) * m + i];
 		}
 	}
 }
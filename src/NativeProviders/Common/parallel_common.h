@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+/*
+	Minimal fork-join helper for the portable (non-MKL) kernels.
+
+	Splits [0, count) into contiguous chunks of at least min_chunk items and
+	runs body(begin, end) on each chunk, one chunk per hardware thread. Runs
+	inline on the calling thread if the range is too small to be worth it,
+	or if no further thread can be started.
+*/
+template<typename Index, typename Body>
+inline void parallel_for(const Index count, const Index min_chunk, Body body)
+{
+	if (count <= 0)
+	{
+		return;
+	}
+
+	const Index hardware = static_cast<Index>(std::max(1u, std::thread::hardware_concurrency()));
+	const Index chunks = std::min(hardware, std::max(static_cast<Index>(1), count / std::max(static_cast<Index>(1), min_chunk)));
+
+	if (chunks <= 1)
+	{
+		body(static_cast<Index>(0), count);
+		return;
+	}
+
+	const Index chunk_size = (count + chunks - 1) / chunks;
+
+	std::vector<std::thread> workers;
+	workers.reserve(chunks - 1);
+
+	for (Index begin = chunk_size; begin < count; begin += chunk_size)
+	{
+		const Index end = std::min(count, begin + chunk_size);
+		try
+		{
+			workers.emplace_back([=]() { body(begin, end); });
+		}
+		catch (std::system_error&)
+		{
+			body(begin, end);
+		}
+	}
+
+	body(static_cast<Index>(0), std::min(count, chunk_size));
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+}
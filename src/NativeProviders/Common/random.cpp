@@ -0,0 +1,343 @@
+#include "wrapper_common.h"
+#include "random_common.h"
+
+#include <cmath>
+#include <cstdint>
+#include <new>
+
+/*
+	Portable counterpart of the MKL random number streams (see MKL/random.c) for OpenBLAS and ATLAS.
+
+	Only RANDOM_PHILOX4X32X10 is available: the counter-based Philox4x32-10 generator of Salmon et al.,
+	keyed by the seed, whose stream can be skipped ahead in constant time. Sequences are not guaranteed
+	to match MKL's bit for bit. Gaussians use Box-Muller, Poisson variates use multiplication of uniforms
+	below POISSON_PTRS_MIN and Hoermann's PTRS rejection above. Status codes use the VSL values.
+*/
+
+const int RANDOM_STATUS_OK = 0;
+const int RANDOM_ERROR_BADARGS = -3;
+const int RANDOM_ERROR_MEMORY = -4;
+const int RANDOM_ERROR_INVALID_GENERATOR = -1000;
+const int RANDOM_ERROR_LEAPFROG_UNSUPPORTED = -1002;
+
+const double POISSON_PTRS_MIN = 10.0;
+const double RANDOM_PI = 3.14159265358979323846;
+
+struct philox_stream
+{
+	uint32_t key[2];
+	uint32_t counter[4];
+	uint32_t buffer[4];
+	int position;
+};
+
+inline void philox_mulhilo(const uint32_t a, const uint32_t b, uint32_t& hi, uint32_t& lo)
+{
+	const uint64_t product = static_cast<uint64_t>(a) * b;
+	hi = static_cast<uint32_t>(product >> 32);
+	lo = static_cast<uint32_t>(product);
+}
+
+inline void philox_block(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4])
+{
+	uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+	uint32_t k0 = key[0], k1 = key[1];
+
+	for (int round = 0; round < 10; ++round)
+	{
+		uint32_t hi0, lo0, hi1, lo1;
+		philox_mulhilo(0xD2511F53u, c0, hi0, lo0);
+		philox_mulhilo(0xCD9E8D57u, c2, hi1, lo1);
+		c0 = hi1 ^ c1 ^ k0;
+		c1 = lo1;
+		c2 = hi0 ^ c3 ^ k1;
+		c3 = lo0;
+		k0 += 0x9E3779B9u;
+		k1 += 0xBB67AE85u;
+	}
+
+	out[0] = c0;
+	out[1] = c1;
+	out[2] = c2;
+	out[3] = c3;
+}
+
+inline void philox_advance(uint32_t counter[4], const uint64_t blocks)
+{
+	uint64_t carry = blocks;
+	for (int i = 0; i < 4 && carry; ++i)
+	{
+		const uint64_t sum = static_cast<uint64_t>(counter[i]) + (carry & 0xFFFFFFFFu);
+		counter[i] = static_cast<uint32_t>(sum);
+		carry = (carry >> 32) + (sum >> 32);
+	}
+}
+
+inline uint32_t philox_next(philox_stream& s)
+{
+	if (s.position == 4)
+	{
+		philox_block(s.counter, s.key, s.buffer);
+		philox_advance(s.counter, 1);
+		s.position = 0;
+	}
+
+	return s.buffer[s.position++];
+}
+
+// Skips n 32-bit outputs.
+inline void philox_skip(philox_stream& s, uint64_t n)
+{
+	const uint64_t buffered = static_cast<uint64_t>(4 - s.position);
+	if (n < buffered)
+	{
+		s.position += static_cast<int>(n);
+		return;
+	}
+
+	n -= buffered;
+	s.position = 4;
+	philox_advance(s.counter, n / 4);
+
+	if (n % 4)
+	{
+		philox_next(s);
+		s.position = static_cast<int>(n % 4);
+	}
+}
+
+// Uniform on [0, 1) with 24 and 53 random bits respectively.
+inline float uniform_float(philox_stream& s)
+{
+	return (philox_next(s) >> 8) * (1.0f / 16777216.0f);
+}
+
+inline double uniform_double(philox_stream& s)
+{
+	const uint32_t a = philox_next(s) >> 5;
+	const uint32_t b = philox_next(s) >> 6;
+	return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+}
+
+inline float uniform(philox_stream& s, float) { return uniform_float(s); }
+inline double uniform(philox_stream& s, double) { return uniform_double(s); }
+
+template<typename T>
+inline void fill_uniform(philox_stream& s, const int n, const T a, const T b, T r[])
+{
+	for (int i = 0; i < n; ++i)
+	{
+		r[i] = a + (b - a) * uniform(s, T());
+	}
+}
+
+template<typename T>
+inline void fill_gaussian(philox_stream& s, const int n, const T mean, const T sigma, T r[])
+{
+	for (int i = 0; i < n; i += 2)
+	{
+		const T radius = std::sqrt(T(-2) * std::log(T(1) - uniform(s, T())));
+		const T angle = T(2 * RANDOM_PI) * uniform(s, T());
+
+		r[i] = mean + sigma * radius * std::cos(angle);
+		if (i + 1 < n)
+		{
+			r[i + 1] = mean + sigma * radius * std::sin(angle);
+		}
+	}
+}
+
+template<typename T>
+inline void fill_exponential(philox_stream& s, const int n, const T displacement, const T beta, T r[])
+{
+	for (int i = 0; i < n; ++i)
+	{
+		r[i] = displacement - beta * std::log(T(1) - uniform(s, T()));
+	}
+}
+
+inline int poisson_multiplication(philox_stream& s, const double limit)
+{
+	int k = 0;
+	double product = uniform_double(s);
+	while (product > limit)
+	{
+		++k;
+		product *= uniform_double(s);
+	}
+
+	return k;
+}
+
+// W. Hoermann, The transformed rejection method for generating Poisson random variables (1993).
+inline int poisson_ptrs(philox_stream& s, const double lambda)
+{
+	const double slam = std::sqrt(lambda);
+	const double loglam = std::log(lambda);
+	const double b = 0.931 + 2.53 * slam;
+	const double a = -0.059 + 0.02483 * b;
+	const double invalpha = 1.1239 + 1.1328 / (b - 3.4);
+	const double vr = 0.9277 - 3.6224 / (b - 2);
+
+	for (;;)
+	{
+		const double u = uniform_double(s) - 0.5;
+		const double v = uniform_double(s);
+		const double us = 0.5 - std::fabs(u);
+		const double k = std::floor((2 * a / us + b) * u + lambda + 0.43);
+
+		if (us >= 0.07 && v <= vr)
+		{
+			return static_cast<int>(k);
+		}
+
+		if (k < 0 || (us < 0.013 && v > us))
+		{
+			continue;
+		}
+
+		if (std::log(v) + std::log(invalpha) - std::log(a / (us * us) + b) <= -lambda + k * loglam - std::lgamma(k + 1))
+		{
+			return static_cast<int>(k);
+		}
+	}
+}
+
+// Vectors x = mean + L*z with z standard normal and L the column-major lower Cholesky factor (as MKL/random.c
+// takes it), computed in place from the last component up.
+template<typename T>
+inline void fill_multivariate_gaussian(philox_stream& s, const int n, const int dimension, const T mean[], const T cholesky[], T r[])
+{
+	for (int v = 0; v < n; ++v)
+	{
+		T* x = r + static_cast<size_t>(v) * dimension;
+		fill_gaussian(s, dimension, T(0), T(1), x);
+
+		for (int i = dimension - 1; i >= 0; --i)
+		{
+			T sum = mean[i];
+			for (int j = 0; j <= i; ++j)
+			{
+				sum += cholesky[i + static_cast<size_t>(j) * dimension] * x[j];
+			}
+
+			x[i] = sum;
+		}
+	}
+}
+
+extern "C" {
+
+	DLLEXPORT int x_random_create(philox_stream** stream, const int generator, const int, const unsigned int seed)
+	{
+		*stream = nullptr;
+		if (generator != RANDOM_PHILOX4X32X10)
+		{
+			return RANDOM_ERROR_INVALID_GENERATOR;
+		}
+
+		auto created = new (std::nothrow) philox_stream();
+		if (!created)
+		{
+			return RANDOM_ERROR_MEMORY;
+		}
+
+		created->key[0] = seed;
+		created->key[1] = 0;
+		created->position = 4;
+		*stream = created;
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int x_random_copy(philox_stream** copy, const philox_stream* stream)
+	{
+		*copy = new (std::nothrow) philox_stream(*stream);
+		return *copy ? RANDOM_STATUS_OK : RANDOM_ERROR_MEMORY;
+	}
+
+	DLLEXPORT int x_random_skip_ahead(philox_stream* stream, const long long skip)
+	{
+		if (skip < 0)
+		{
+			return RANDOM_ERROR_BADARGS;
+		}
+
+		philox_skip(*stream, static_cast<uint64_t>(skip));
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int x_random_leapfrog(philox_stream*, const int, const int)
+	{
+		return RANDOM_ERROR_LEAPFROG_UNSUPPORTED;
+	}
+
+	DLLEXPORT int x_random_free(philox_stream* stream)
+	{
+		delete stream;
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int s_random_uniform(philox_stream* stream, const int n, const float a, const float b, float r[])
+	{
+		fill_uniform(*stream, n, a, b, r);
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int d_random_uniform(philox_stream* stream, const int n, const double a, const double b, double r[])
+	{
+		fill_uniform(*stream, n, a, b, r);
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int s_random_gaussian(philox_stream* stream, const int n, const float mean, const float sigma, float r[])
+	{
+		fill_gaussian(*stream, n, mean, sigma, r);
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int d_random_gaussian(philox_stream* stream, const int n, const double mean, const double sigma, double r[])
+	{
+		fill_gaussian(*stream, n, mean, sigma, r);
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int s_random_exponential(philox_stream* stream, const int n, const float displacement, const float beta, float r[])
+	{
+		fill_exponential(*stream, n, displacement, beta, r);
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int d_random_exponential(philox_stream* stream, const int n, const double displacement, const double beta, double r[])
+	{
+		fill_exponential(*stream, n, displacement, beta, r);
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int x_random_poisson(philox_stream* stream, const int n, const double lambda, int r[])
+	{
+		if (!(lambda > 0))
+		{
+			return RANDOM_ERROR_BADARGS;
+		}
+
+		const double limit = std::exp(-lambda);
+		for (int i = 0; i < n; ++i)
+		{
+			r[i] = lambda < POISSON_PTRS_MIN ? poisson_multiplication(*stream, limit) : poisson_ptrs(*stream, lambda);
+		}
+
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int s_random_multivariate_gaussian(philox_stream* stream, const int n, const int dimension, const float mean[], const float cholesky[], float r[])
+	{
+		fill_multivariate_gaussian(*stream, n, dimension, mean, cholesky, r);
+		return RANDOM_STATUS_OK;
+	}
+
+	DLLEXPORT int d_random_multivariate_gaussian(philox_stream* stream, const int n, const int dimension, const double mean[], const double cholesky[], double r[])
+	{
+		fill_multivariate_gaussian(*stream, n, dimension, mean, cholesky, r);
+		return RANDOM_STATUS_OK;
+	}
+}
@@ -0,0 +1,21 @@
+#ifndef RANDOM_COMMON_H
+#define RANDOM_COMMON_H
+
+/*
+	Basic generators accepted by x_random_create, shared by the MKL (MKL/random.c) and the
+	portable (Common/random.cpp) random number streams. Must stay valid C as well as C++.
+*/
+
+/* Mersenne Twister MT19937; seed is the 32-bit seed. */
+#define RANDOM_MT19937 0
+
+/* Member `member` (0..6023) of the MT2203 family of independent Mersenne Twisters. */
+#define RANDOM_MT2203 1
+
+/* Counter-based Philox4x32-10; supports skip-ahead and is available in all providers. */
+#define RANDOM_PHILOX4X32X10 2
+
+/* Sobol quasi-random sequence; seed is the dimension of the sequence. */
+#define RANDOM_SOBOL 3
+
+#endif
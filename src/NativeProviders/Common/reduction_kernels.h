@@ -0,0 +1,205 @@
+#pragma once
+
+#include "simd_common.h"
+
+#include <math.h>
+
+/*
+	Vector kernels of reductions.cpp, compiled once per dispatch target like vector_kernels.h (reductions.cpp for
+	the baseline, reduction_kernels_avx2.cpp and reduction_kernels_avx512.cpp) and reached through the
+	reduction_kernels table of the target picked at runtime.
+*/
+
+template<typename T>
+struct reduction_kernel_table
+{
+	// Reduction of x[0..n)
+	typedef T (*reduce)(int n, const T* x);
+
+	// result[i] += f(col[i]) for i in [begin, end)
+	typedef void (*accumulate)(int begin, int end, const T* col, T* result);
+
+	reduce sum;
+	reduce sum_squares;
+	reduce min;
+	reduce max;
+	accumulate accumulate_sum;
+	accumulate accumulate_sum_squares;
+};
+
+struct reduction_kernels
+{
+	reduction_kernel_table<float> s;
+	reduction_kernel_table<double> d;
+};
+
+extern const reduction_kernels reduction_kernels_base;
+extern const reduction_kernels reduction_kernels_avx2;
+extern const reduction_kernels reduction_kernels_avx512;
+
+namespace SIMD_NAMESPACE {
+
+const int REDUCE_ACCUMULATORS = 4;
+
+template<bool Square, typename V>
+inline V accumulate(const V acc, const V v)
+{
+	return simd_add(acc, Square ? simd_multiply(v, v) : v);
+}
+
+template<typename Unit, typename T>
+inline T horizontal_sum(const typename Unit::reg v)
+{
+	T lanes[Unit::width];
+	Unit::store(lanes, v);
+
+	T sum = lanes[0];
+	for (int i = 1; i < Unit::width; ++i)
+	{
+		sum += lanes[i];
+	}
+
+	return sum;
+}
+
+template<typename Op, typename Unit, typename T>
+inline T horizontal_extreme(const typename Unit::reg v)
+{
+	T lanes[Unit::width];
+	Unit::store(lanes, v);
+
+	T best = lanes[0];
+	for (int i = 1; i < Unit::width; ++i)
+	{
+		best = Op::apply(lanes[i], best);
+	}
+
+	return best;
+}
+
+struct min_op
+{
+	template<typename V> static V apply(const V a, const V b) { return simd_min(a, b); }
+	template<typename T> static bool better(const T a, const T b) { return a < b; }
+	template<typename T> static T identity() { return static_cast<T>(INFINITY); }
+	template<typename T> static typename reduction_kernel_table<T>::reduce kernel(const reduction_kernel_table<T>& table) { return table.min; }
+};
+
+struct max_op
+{
+	template<typename V> static V apply(const V a, const V b) { return simd_max(a, b); }
+	template<typename T> static bool better(const T a, const T b) { return a > b; }
+	template<typename T> static T identity() { return static_cast<T>(-INFINITY); }
+	template<typename T> static typename reduction_kernel_table<T>::reduce kernel(const reduction_kernel_table<T>& table) { return table.max; }
+};
+
+template<bool Square, typename T>
+T sum_kernel(const int n, const T* x)
+{
+	typedef simd_unit<T> unit;
+	const int step = REDUCE_ACCUMULATORS * unit::width;
+
+	typename unit::reg acc[REDUCE_ACCUMULATORS];
+	for (int k = 0; k < REDUCE_ACCUMULATORS; ++k)
+	{
+		acc[k] = unit::broadcast(T(0));
+	}
+
+	int i = 0;
+	for (; i + step <= n; i += step)
+	{
+		for (int k = 0; k < REDUCE_ACCUMULATORS; ++k)
+		{
+			acc[k] = accumulate<Square>(acc[k], unit::load(x + i + k * unit::width));
+		}
+	}
+
+	for (; i + unit::width <= n; i += unit::width)
+	{
+		acc[0] = accumulate<Square>(acc[0], unit::load(x + i));
+	}
+
+	for (int k = 1; k < REDUCE_ACCUMULATORS; ++k)
+	{
+		acc[0] = simd_add(acc[0], acc[k]);
+	}
+
+	T sum = horizontal_sum<unit, T>(acc[0]);
+	for (; i < n; ++i)
+	{
+		sum = accumulate<Square>(sum, x[i]);
+	}
+
+	return sum;
+}
+
+// Extreme value of x[0..n), ignoring NaN; Op::identity if there is none.
+template<typename Op, typename T>
+T extreme_kernel(const int n, const T* x)
+{
+	typedef simd_unit<T> unit;
+	const int step = REDUCE_ACCUMULATORS * unit::width;
+
+	typename unit::reg acc[REDUCE_ACCUMULATORS];
+	for (int k = 0; k < REDUCE_ACCUMULATORS; ++k)
+	{
+		acc[k] = unit::broadcast(Op::template identity<T>());
+	}
+
+	int i = 0;
+	for (; i + step <= n; i += step)
+	{
+		for (int k = 0; k < REDUCE_ACCUMULATORS; ++k)
+		{
+			acc[k] = Op::apply(unit::load(x + i + k * unit::width), acc[k]);
+		}
+	}
+
+	for (; i + unit::width <= n; i += unit::width)
+	{
+		acc[0] = Op::apply(unit::load(x + i), acc[0]);
+	}
+
+	for (int k = 1; k < REDUCE_ACCUMULATORS; ++k)
+	{
+		acc[0] = Op::apply(acc[k], acc[0]);
+	}
+
+	T best = horizontal_extreme<Op, unit, T>(acc[0]);
+	for (; i < n; ++i)
+	{
+		best = Op::apply(x[i], best);
+	}
+
+	return best;
+}
+
+template<bool Square, typename T>
+void accumulate_column(const int begin, const int end, const T* col, T* result)
+{
+	typedef simd_unit<T> unit;
+
+	int i = begin;
+	for (; i + unit::width <= end; i += unit::width)
+	{
+		unit::store(result + i, accumulate<Square>(unit::load(result + i), unit::load(col + i)));
+	}
+
+	for (; i < end; ++i)
+	{
+		result[i] = accumulate<Square>(result[i], col[i]);
+	}
+}
+
+}
+
+// Kernel table of the target the including translation unit is compiled for.
+#define REDUCTION_KERNEL_TABLE(T) { \
+	&SIMD_NAMESPACE::sum_kernel<false, T>, \
+	&SIMD_NAMESPACE::sum_kernel<true, T>, \
+	&SIMD_NAMESPACE::extreme_kernel<SIMD_NAMESPACE::min_op, T>, \
+	&SIMD_NAMESPACE::extreme_kernel<SIMD_NAMESPACE::max_op, T>, \
+	&SIMD_NAMESPACE::accumulate_column<false, T>, \
+	&SIMD_NAMESPACE::accumulate_column<true, T> }
+
+#define REDUCTION_KERNELS { REDUCTION_KERNEL_TABLE(float), REDUCTION_KERNEL_TABLE(double) }
@@ -0,0 +1,5 @@
+// Compiled with AVX2 enabled (/arch:AVX2, -mavx2 -mfma); only called once simd_dispatch.h found AVX2 support.
+#define SIMD_KERNELS_AVX2
+#include "reduction_kernels.h"
+
+extern const reduction_kernels reduction_kernels_avx2 = REDUCTION_KERNELS;
@@ -0,0 +1,5 @@
+// Compiled with AVX-512 enabled (/arch:AVX512, -mavx512f); only called once simd_dispatch.h found AVX-512 support.
+#define SIMD_KERNELS_AVX512
+#include "reduction_kernels.h"
+
+extern const reduction_kernels reduction_kernels_avx512 = REDUCTION_KERNELS;
@@ -0,0 +1,347 @@
+#include "wrapper_common.h"
+#include "parallel_common.h"
+#include "simd_dispatch.h"
+#include "reduction_kernels.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/*
+	Reductions over whole vectors and along one axis of a column-major rows x cols matrix,
+	shared by all providers. axis 0 reduces each column (cols results), axis 1 reduces each row (rows results).
+
+	Whole vectors and columns run through simd_unit registers with REDUCE_ACCUMULATORS independent
+	accumulators to hide the add latency, using the kernels of reduction_kernels.h for the widest registers
+	the processor supports (see simd_dispatch.h). Rows are reduced by accumulating whole columns into a block
+	of per-row results, so the matrix is still read contiguously. Vectors are split into fixed chunks of
+	REDUCE_PARALLEL_MIN elements whose partial results are combined in order, so results do not depend
+	on the number of threads.
+
+	Min/max with index return the zero-based index of the first extreme value and ignore NaN;
+	an all-NaN vector yields index 0 (with its NaN value), an empty one -1.
+*/
+
+using namespace SIMD_NAMESPACE;
+
+// Elements per chunk of a threaded reduction.
+const int REDUCE_PARALLEL_MIN = 1 << 16;
+
+// Elements per block of the argmin/argmax search; a block is rescanned only if it holds a new extreme.
+const int REDUCE_SEARCH_BLOCK = 1024;
+
+// Rows per block of the per-row reductions, sized so the block results stay in L1.
+const int REDUCE_ROW_BLOCK = 1024;
+
+extern const reduction_kernels reduction_kernels_base = REDUCTION_KERNELS;
+
+inline const reduction_kernels& reduction_kernels_runtime()
+{
+	static const reduction_kernels& kernels = simd_select(reduction_kernels_base, reduction_kernels_avx2, reduction_kernels_avx512);
+	return kernels;
+}
+
+template<typename T>
+inline const reduction_kernel_table<T>& reduction_kernels_for();
+
+template<>
+inline const reduction_kernel_table<float>& reduction_kernels_for<float>()
+{
+	return reduction_kernels_runtime().s;
+}
+
+template<>
+inline const reduction_kernel_table<double>& reduction_kernels_for<double>()
+{
+	return reduction_kernels_runtime().d;
+}
+
+template<bool Square, typename T>
+inline typename reduction_kernel_table<T>::reduce sum_kernel_for()
+{
+	return Square ? reduction_kernels_for<T>().sum_squares : reduction_kernels_for<T>().sum;
+}
+
+template<bool Square, typename T>
+inline typename reduction_kernel_table<T>::accumulate accumulate_kernel_for()
+{
+	return Square ? reduction_kernels_for<T>().accumulate_sum_squares : reduction_kernels_for<T>().accumulate_sum;
+}
+
+// (index, value) of the first extreme value in x[begin..end), index -1 if all values are NaN.
+template<typename Op, typename T>
+inline std::pair<int, T> extreme_index_kernel(const int begin, const int end, const T* x)
+{
+	const typename reduction_kernel_table<T>::reduce extreme = Op::kernel(reduction_kernels_for<T>());
+	std::pair<int, T> best(-1, Op::template identity<T>());
+
+	for (int b = begin; b < end; b += REDUCE_SEARCH_BLOCK)
+	{
+		const int m = std::min(REDUCE_SEARCH_BLOCK, end - b);
+		const T block = extreme(m, x + b);
+		if (best.first >= 0 && !Op::better(block, best.second))
+		{
+			continue;
+		}
+
+		for (int i = b; i < b + m; ++i)
+		{
+			if (x[i] == block)
+			{
+				best = std::make_pair(i, block);
+				break;
+			}
+		}
+	}
+
+	return best;
+}
+
+template<typename Op, typename T>
+inline std::pair<int, T> combine_extreme(const std::pair<int, T>& first, const std::pair<int, T>& second)
+{
+	if (first.first < 0 || (second.first >= 0 && Op::better(second.second, first.second)))
+	{
+		return second;
+	}
+
+	return first;
+}
+
+/*
+	Reduces x[0..n) chunk by chunk with kernel(begin, end) and folds the partial results in chunk order
+	with combine; chunks are distributed over threads if there is more than one.
+*/
+template<typename R, typename Kernel, typename Combine>
+inline R reduce_chunks(const int n, Kernel kernel, Combine combine)
+{
+	const int chunks = (n + REDUCE_PARALLEL_MIN - 1) / REDUCE_PARALLEL_MIN;
+	if (chunks <= 1)
+	{
+		return kernel(0, n);
+	}
+
+	std::vector<R> partial(chunks);
+	parallel_for(chunks, 1, [&](int first, int last)
+	{
+		for (int c = first; c < last; ++c)
+		{
+			partial[c] = kernel(c * REDUCE_PARALLEL_MIN, std::min(n, (c + 1) * REDUCE_PARALLEL_MIN));
+		}
+	});
+
+	R result = partial[0];
+	for (int c = 1; c < chunks; ++c)
+	{
+		result = combine(result, partial[c]);
+	}
+
+	return result;
+}
+
+template<bool Square, typename T>
+inline T vector_sum(const int n, const T* x)
+{
+	const typename reduction_kernel_table<T>::reduce sum = sum_kernel_for<Square, T>();
+	return reduce_chunks<T>(n,
+		[=](int begin, int end) { return sum(end - begin, x + begin); },
+		[](T a, T b) { return a + b; });
+}
+
+template<typename Op, typename T>
+inline int vector_extreme_index(const int n, const T* x, T* value)
+{
+	if (n <= 0)
+	{
+		return -1;
+	}
+
+	const auto best = reduce_chunks<std::pair<int, T>>(n,
+		[=](int begin, int end) { return extreme_index_kernel<Op>(begin, end, x); },
+		combine_extreme<Op, T>);
+
+	const int index = best.first < 0 ? 0 : best.first;
+	*value = x[index];
+	return index;
+}
+
+// Columns (or rows) per thread so that each thread reduces at least REDUCE_PARALLEL_MIN elements.
+inline int lines_per_thread(const int length)
+{
+	return std::max(1, REDUCE_PARALLEL_MIN / std::max(1, length));
+}
+
+template<typename T>
+inline const T* column(const T* a, const int rows, const int j)
+{
+	return a + static_cast<size_t>(j) * rows;
+}
+
+template<bool Square, typename T>
+inline void matrix_sum(const int axis, const int rows, const int cols, const T* a, T* result)
+{
+	if (axis == 0)
+	{
+		const typename reduction_kernel_table<T>::reduce sum = sum_kernel_for<Square, T>();
+		parallel_for(cols, lines_per_thread(rows), [=](int first, int last)
+		{
+			for (int j = first; j < last; ++j)
+			{
+				result[j] = sum(rows, column(a, rows, j));
+			}
+		});
+
+		return;
+	}
+
+	const typename reduction_kernel_table<T>::accumulate accumulate_column = accumulate_kernel_for<Square, T>();
+	parallel_for(rows, lines_per_thread(cols), [=](int first, int last)
+	{
+		for (int ib = first; ib < last; ib += REDUCE_ROW_BLOCK)
+		{
+			const int ie = std::min(last, ib + REDUCE_ROW_BLOCK);
+			std::fill(result + ib, result + ie, T(0));
+			for (int j = 0; j < cols; ++j)
+			{
+				accumulate_column(ib, ie, column(a, rows, j), result);
+			}
+		}
+	});
+}
+
+template<typename Op, typename T>
+inline void matrix_extreme_index(const int axis, const int rows, const int cols, const T* a, int indices[], T values[])
+{
+	if (axis == 0)
+	{
+		parallel_for(cols, lines_per_thread(rows), [=](int first, int last)
+		{
+			for (int j = first; j < last; ++j)
+			{
+				const T* col = column(a, rows, j);
+				const auto best = extreme_index_kernel<Op>(0, rows, col);
+				indices[j] = rows > 0 ? std::max(0, best.first) : -1;
+				values[j] = rows > 0 ? col[indices[j]] : Op::template identity<T>();
+			}
+		});
+
+		return;
+	}
+
+	parallel_for(rows, lines_per_thread(cols), [=](int first, int last)
+	{
+		for (int ib = first; ib < last; ib += REDUCE_ROW_BLOCK)
+		{
+			const int ie = std::min(last, ib + REDUCE_ROW_BLOCK);
+			std::fill(indices + ib, indices + ie, -1);
+			std::fill(values + ib, values + ie, Op::template identity<T>());
+
+			for (int j = 0; j < cols; ++j)
+			{
+				const T* col = column(a, rows, j);
+				for (int i = ib; i < ie; ++i)
+				{
+					const T v = col[i];
+					if (Op::better(v, values[i]) || (indices[i] < 0 && v == v))
+					{
+						values[i] = v;
+						indices[i] = j;
+					}
+				}
+			}
+
+			for (int i = ib; i < ie; ++i)
+			{
+				if (indices[i] < 0 && cols > 0)
+				{
+					indices[i] = 0;
+					values[i] = a[i];
+				}
+			}
+		}
+	});
+}
+
+extern "C" {
+
+	DLLEXPORT float s_vector_sum(const int n, const float x[])
+	{
+		return vector_sum<false>(n, x);
+	}
+
+	DLLEXPORT double d_vector_sum(const int n, const double x[])
+	{
+		return vector_sum<false>(n, x);
+	}
+
+	DLLEXPORT float s_vector_sum_squares(const int n, const float x[])
+	{
+		return vector_sum<true>(n, x);
+	}
+
+	DLLEXPORT double d_vector_sum_squares(const int n, const double x[])
+	{
+		return vector_sum<true>(n, x);
+	}
+
+	DLLEXPORT int s_vector_min_index(const int n, const float x[], float* value)
+	{
+		return vector_extreme_index<min_op>(n, x, value);
+	}
+
+	DLLEXPORT int d_vector_min_index(const int n, const double x[], double* value)
+	{
+		return vector_extreme_index<min_op>(n, x, value);
+	}
+
+	DLLEXPORT int s_vector_max_index(const int n, const float x[], float* value)
+	{
+		return vector_extreme_index<max_op>(n, x, value);
+	}
+
+	DLLEXPORT int d_vector_max_index(const int n, const double x[], double* value)
+	{
+		return vector_extreme_index<max_op>(n, x, value);
+	}
+
+	DLLEXPORT void s_matrix_sum(const int axis, const int rows, const int cols, const float a[], float result[])
+	{
+		matrix_sum<false>(axis, rows, cols, a, result);
+	}
+
+	DLLEXPORT void d_matrix_sum(const int axis, const int rows, const int cols, const double a[], double result[])
+	{
+		matrix_sum<false>(axis, rows, cols, a, result);
+	}
+
+	DLLEXPORT void s_matrix_sum_squares(const int axis, const int rows, const int cols, const float a[], float result[])
+	{
+		matrix_sum<true>(axis, rows, cols, a, result);
+	}
+
+	DLLEXPORT void d_matrix_sum_squares(const int axis, const int rows, const int cols, const double a[], double result[])
+	{
+		matrix_sum<true>(axis, rows, cols, a, result);
+	}
+
+	DLLEXPORT void s_matrix_min_index(const int axis, const int rows, const int cols, const float a[], int indices[], float values[])
+	{
+		matrix_extreme_index<min_op>(axis, rows, cols, a, indices, values);
+	}
+
+	DLLEXPORT void d_matrix_min_index(const int axis, const int rows, const int cols, const double a[], int indices[], double values[])
+	{
+		matrix_extreme_index<min_op>(axis, rows, cols, a, indices, values);
+	}
+
+	DLLEXPORT void s_matrix_max_index(const int axis, const int rows, const int cols, const float a[], int indices[], float values[])
+	{
+		matrix_extreme_index<max_op>(axis, rows, cols, a, indices, values);
+	}
+
+	DLLEXPORT void d_matrix_max_index(const int axis, const int rows, const int cols, const double a[], int indices[], double values[])
+	{
+		matrix_extreme_index<max_op>(axis, rows, cols, a, indices, values);
+	}
+}
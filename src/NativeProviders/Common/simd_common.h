@@ -0,0 +1,179 @@
+#pragma once
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86
+#endif
+
+/*
+	Kernels built on this header are compiled once per dispatch target (see simd_dispatch.h): for the baseline ISA
+	of the build, and in translation units that define SIMD_KERNELS_AVX2 or SIMD_KERNELS_AVX512 before including it
+	and are compiled with that instruction set enabled. Each target gets its own namespace, so the differently
+	compiled instantiations of the same template never meet at link time.
+*/
+#if defined(SIMD_KERNELS_AVX512)
+#define SIMD_NAMESPACE simd_avx512
+#if defined(SIMD_X86) && !defined(__AVX512F__)
+#error "AVX-512 kernels must be compiled with AVX-512 enabled (/arch:AVX512, -mavx512f)"
+#endif
+#elif defined(SIMD_KERNELS_AVX2)
+#define SIMD_NAMESPACE simd_avx2
+#if defined(SIMD_X86) && !defined(__AVX2__)
+#error "AVX2 kernels must be compiled with AVX2 enabled (/arch:AVX2, -mavx2 -mfma)"
+#endif
+#else
+#define SIMD_NAMESPACE simd_base
+#endif
+
+#if defined(__AVX512F__)
+#define SIMD_AVX512
+#include <immintrin.h>
+#elif defined(__AVX2__) || defined(__AVX__)
+#define SIMD_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+/*
+	Register abstraction for the portable element-wise and reduction kernels.
+
+	simd_unit<T> exposes the widest float/double register the translation unit is compiled for (AVX-512,
+	AVX/AVX2 or SSE2) and degrades to scalar_unit<T> for other types or builds. The simd_* operations are
+	overloaded for both registers and scalars, so a kernel written against a unit also handles the scalar tail.
+	simd_min/simd_max follow the SSE semantics and return the second operand if either one is NaN.
+*/
+
+namespace SIMD_NAMESPACE {
+
+template<typename T>
+struct scalar_unit
+{
+	typedef T reg;
+	static const int width = 1;
+
+	static reg load(const T* p) { return *p; }
+	static void store(T* p, const reg v) { *p = v; }
+	static reg broadcast(const T v) { return v; }
+};
+
+template<typename T>
+struct simd_unit : scalar_unit<T>
+{
+};
+
+template<typename V> inline V simd_add(const V a, const V b) { return a + b; }
+template<typename V> inline V simd_subtract(const V a, const V b) { return a - b; }
+template<typename V> inline V simd_multiply(const V a, const V b) { return a * b; }
+template<typename V> inline V simd_divide(const V a, const V b) { return a / b; }
+template<typename V> inline V simd_min(const V a, const V b) { return a < b ? a : b; }
+template<typename V> inline V simd_max(const V a, const V b) { return a > b ? a : b; }
+
+#if defined(SIMD_AVX512)
+template<>
+struct simd_unit<float>
+{
+	typedef __m512 reg;
+	static const int width = 16;
+
+	static reg load(const float* p) { return _mm512_loadu_ps(p); }
+	static void store(float* p, const reg v) { _mm512_storeu_ps(p, v); }
+	static reg broadcast(const float v) { return _mm512_set1_ps(v); }
+};
+
+template<>
+struct simd_unit<double>
+{
+	typedef __m512d reg;
+	static const int width = 8;
+
+	static reg load(const double* p) { return _mm512_loadu_pd(p); }
+	static void store(double* p, const reg v) { _mm512_storeu_pd(p, v); }
+	static reg broadcast(const double v) { return _mm512_set1_pd(v); }
+};
+
+inline __m512 simd_add(const __m512 a, const __m512 b) { return _mm512_add_ps(a, b); }
+inline __m512 simd_subtract(const __m512 a, const __m512 b) { return _mm512_sub_ps(a, b); }
+inline __m512 simd_multiply(const __m512 a, const __m512 b) { return _mm512_mul_ps(a, b); }
+inline __m512 simd_divide(const __m512 a, const __m512 b) { return _mm512_div_ps(a, b); }
+inline __m512 simd_min(const __m512 a, const __m512 b) { return _mm512_min_ps(a, b); }
+inline __m512 simd_max(const __m512 a, const __m512 b) { return _mm512_max_ps(a, b); }
+inline __m512d simd_add(const __m512d a, const __m512d b) { return _mm512_add_pd(a, b); }
+inline __m512d simd_subtract(const __m512d a, const __m512d b) { return _mm512_sub_pd(a, b); }
+inline __m512d simd_multiply(const __m512d a, const __m512d b) { return _mm512_mul_pd(a, b); }
+inline __m512d simd_divide(const __m512d a, const __m512d b) { return _mm512_div_pd(a, b); }
+inline __m512d simd_min(const __m512d a, const __m512d b) { return _mm512_min_pd(a, b); }
+inline __m512d simd_max(const __m512d a, const __m512d b) { return _mm512_max_pd(a, b); }
+#elif defined(SIMD_AVX)
+template<>
+struct simd_unit<float>
+{
+	typedef __m256 reg;
+	static const int width = 8;
+
+	static reg load(const float* p) { return _mm256_loadu_ps(p); }
+	static void store(float* p, const reg v) { _mm256_storeu_ps(p, v); }
+	static reg broadcast(const float v) { return _mm256_set1_ps(v); }
+};
+
+template<>
+struct simd_unit<double>
+{
+	typedef __m256d reg;
+	static const int width = 4;
+
+	static reg load(const double* p) { return _mm256_loadu_pd(p); }
+	static void store(double* p, const reg v) { _mm256_storeu_pd(p, v); }
+	static reg broadcast(const double v) { return _mm256_set1_pd(v); }
+};
+
+inline __m256 simd_add(const __m256 a, const __m256 b) { return _mm256_add_ps(a, b); }
+inline __m256 simd_subtract(const __m256 a, const __m256 b) { return _mm256_sub_ps(a, b); }
+inline __m256 simd_multiply(const __m256 a, const __m256 b) { return _mm256_mul_ps(a, b); }
+inline __m256 simd_divide(const __m256 a, const __m256 b) { return _mm256_div_ps(a, b); }
+inline __m256 simd_min(const __m256 a, const __m256 b) { return _mm256_min_ps(a, b); }
+inline __m256 simd_max(const __m256 a, const __m256 b) { return _mm256_max_ps(a, b); }
+inline __m256d simd_add(const __m256d a, const __m256d b) { return _mm256_add_pd(a, b); }
+inline __m256d simd_subtract(const __m256d a, const __m256d b) { return _mm256_sub_pd(a, b); }
+inline __m256d simd_multiply(const __m256d a, const __m256d b) { return _mm256_mul_pd(a, b); }
+inline __m256d simd_divide(const __m256d a, const __m256d b) { return _mm256_div_pd(a, b); }
+inline __m256d simd_min(const __m256d a, const __m256d b) { return _mm256_min_pd(a, b); }
+inline __m256d simd_max(const __m256d a, const __m256d b) { return _mm256_max_pd(a, b); }
+#elif defined(SIMD_SSE2)
+template<>
+struct simd_unit<float>
+{
+	typedef __m128 reg;
+	static const int width = 4;
+
+	static reg load(const float* p) { return _mm_loadu_ps(p); }
+	static void store(float* p, const reg v) { _mm_storeu_ps(p, v); }
+	static reg broadcast(const float v) { return _mm_set1_ps(v); }
+};
+
+template<>
+struct simd_unit<double>
+{
+	typedef __m128d reg;
+	static const int width = 2;
+
+	static reg load(const double* p) { return _mm_loadu_pd(p); }
+	static void store(double* p, const reg v) { _mm_storeu_pd(p, v); }
+	static reg broadcast(const double v) { return _mm_set1_pd(v); }
+};
+
+inline __m128 simd_add(const __m128 a, const __m128 b) { return _mm_add_ps(a, b); }
+inline __m128 simd_subtract(const __m128 a, const __m128 b) { return _mm_sub_ps(a, b); }
+inline __m128 simd_multiply(const __m128 a, const __m128 b) { return _mm_mul_ps(a, b); }
+inline __m128 simd_divide(const __m128 a, const __m128 b) { return _mm_div_ps(a, b); }
+inline __m128 simd_min(const __m128 a, const __m128 b) { return _mm_min_ps(a, b); }
+inline __m128 simd_max(const __m128 a, const __m128 b) { return _mm_max_ps(a, b); }
+inline __m128d simd_add(const __m128d a, const __m128d b) { return _mm_add_pd(a, b); }
+inline __m128d simd_subtract(const __m128d a, const __m128d b) { return _mm_sub_pd(a, b); }
+inline __m128d simd_multiply(const __m128d a, const __m128d b) { return _mm_mul_pd(a, b); }
+inline __m128d simd_divide(const __m128d a, const __m128d b) { return _mm_div_pd(a, b); }
+inline __m128d simd_min(const __m128d a, const __m128d b) { return _mm_min_pd(a, b); }
+inline __m128d simd_max(const __m128d a, const __m128d b) { return _mm_max_pd(a, b); }
+#endif
+
+}
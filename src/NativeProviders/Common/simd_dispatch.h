@@ -0,0 +1,101 @@
+#pragma once
+
+#include "simd_common.h"
+
+#if defined(SIMD_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/*
+	Runtime selection between the kernel builds of simd_common.h. The providers are compiled for the baseline ISA
+	(SSE2 on x64), so the kernels that profit from wider registers are also compiled in separate translation units
+	with AVX2 and AVX-512 enabled, each exporting a table of its kernels. On first use the widest table the
+	processor and the operating system support is picked; callers go through that table from then on.
+	Only include this header in baseline translation units.
+*/
+
+enum simd_isa
+{
+	SIMD_ISA_BASE = 0,
+	SIMD_ISA_AVX2 = 1,
+	SIMD_ISA_AVX512 = 2
+};
+
+#if defined(SIMD_X86)
+inline void simd_cpuid(const int leaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+	int r[4];
+	__cpuidex(r, leaf, 0);
+	for (int i = 0; i < 4; ++i)
+	{
+		regs[i] = static_cast<unsigned int>(r[i]);
+	}
+#else
+	__cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// Register state the operating system saves on context switches (XCR0).
+inline unsigned long long simd_xcr0()
+{
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	unsigned int eax, edx;
+	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+inline simd_isa simd_detect()
+{
+#if defined(SIMD_X86)
+	unsigned int regs[4];
+	simd_cpuid(0, regs);
+	if (regs[0] < 7) return SIMD_ISA_BASE;
+
+	// AVX2 kernels are compiled with FMA as well; both need the OS to save the YMM state.
+	simd_cpuid(1, regs);
+	const bool osxsave = (regs[2] & (1u << 27)) != 0;
+	const bool avx = (regs[2] & (1u << 28)) != 0;
+	const bool fma = (regs[2] & (1u << 12)) != 0;
+	if (!osxsave || !avx || !fma) return SIMD_ISA_BASE;
+
+	const unsigned long long xcr0 = simd_xcr0();
+	if ((xcr0 & 0x6) != 0x6) return SIMD_ISA_BASE;
+
+	simd_cpuid(7, regs);
+	const bool avx2 = (regs[1] & (1u << 5)) != 0;
+	const bool avx512f = (regs[1] & (1u << 16)) != 0;
+	if (!avx2) return SIMD_ISA_BASE;
+
+	// AVX-512 additionally needs the opmask and ZMM state.
+	return avx512f && (xcr0 & 0xE6) == 0xE6 ? SIMD_ISA_AVX512 : SIMD_ISA_AVX2;
+#else
+	return SIMD_ISA_BASE;
+#endif
+}
+
+// The ISA detected on first use.
+inline simd_isa simd_runtime_isa()
+{
+	static const simd_isa isa = simd_detect();
+	return isa;
+}
+
+template<typename Table>
+inline const Table& simd_select(const Table& base, const Table& avx2, const Table& avx512)
+{
+	switch (simd_runtime_isa())
+	{
+	case SIMD_ISA_AVX512: return avx512;
+	case SIMD_ISA_AVX2: return avx2;
+	default: return base;
+	}
+}
@@ -0,0 +1,165 @@
+#include "wrapper_common.h"
+#include "blas.h"
+#include "parallel_common.h"
+#include "simd_dispatch.h"
+#include "vector_kernels.h"
+
+#include <cmath>
+#include <complex>
+
+/*
+	Portable counterpart of the MKL element-wise vector functions (see MKL/vector_functions.c) for OpenBLAS and ATLAS.
+	Real add/subtract/multiply/divide run on the widest registers the processor supports, through the kernels
+	of vector_kernels.h picked at runtime (see simd_dispatch.h).
+	Power and the complex functions are evaluated element by element with the standard library.
+	Vectors large enough to amortise thread start-up are split across hardware threads.
+*/
+
+using namespace SIMD_NAMESPACE;
+
+// Minimum number of elements per thread for the memory-bound arithmetic functions.
+const int VECTOR_PARALLEL_MIN_ARITHMETIC = 1 << 16;
+
+// Minimum number of elements per thread for the compute-bound power function.
+const int VECTOR_PARALLEL_MIN_POWER = 1 << 12;
+
+extern const vector_kernels vector_kernels_base = VECTOR_KERNELS;
+
+struct power_op { template<typename V> static V apply(const V a, const V b) { return std::pow(a, b); } };
+
+inline const vector_kernels& vector_kernels_runtime()
+{
+	static const vector_kernels& kernels = simd_select(vector_kernels_base, vector_kernels_avx2, vector_kernels_avx512);
+	return kernels;
+}
+
+template<typename T>
+inline void vector_apply(const int n, const int min_chunk, const typename vector_kernel_table<T>::kernel kernel, const T* x, const T* y, T* result)
+{
+	parallel_for(n, min_chunk, [=](int begin, int end)
+	{
+		kernel(begin, end, x, y, result);
+	});
+}
+
+template<typename T>
+inline void vector_arithmetic(const int n, const typename vector_kernel_table<T>::kernel kernel, const T* x, const T* y, T* result)
+{
+	vector_apply(n, VECTOR_PARALLEL_MIN_ARITHMETIC, kernel, x, y, result);
+}
+
+// Complex arithmetic, element by element.
+template<typename Op, typename T>
+inline void vector_arithmetic(const int n, const std::complex<T>* x, const std::complex<T>* y, std::complex<T>* result)
+{
+	vector_apply(n, VECTOR_PARALLEL_MIN_ARITHMETIC, &vector_kernel<Op, scalar_unit<std::complex<T>>, std::complex<T>>, x, y, result);
+}
+
+template<typename T>
+inline void vector_power(const int n, const T* x, const T* y, T* result)
+{
+	vector_apply(n, VECTOR_PARALLEL_MIN_POWER, &vector_kernel<power_op, scalar_unit<T>, T>, x, y, result);
+}
+
+extern "C" {
+
+	DLLEXPORT void s_vector_add(const int n, const float x[], const float y[], float result[])
+	{
+		vector_arithmetic(n, vector_kernels_runtime().s.add, x, y, result);
+	}
+
+	DLLEXPORT void s_vector_subtract(const int n, const float x[], const float y[], float result[])
+	{
+		vector_arithmetic(n, vector_kernels_runtime().s.subtract, x, y, result);
+	}
+
+	DLLEXPORT void s_vector_multiply(const int n, const float x[], const float y[], float result[])
+	{
+		vector_arithmetic(n, vector_kernels_runtime().s.multiply, x, y, result);
+	}
+
+	DLLEXPORT void s_vector_divide(const int n, const float x[], const float y[], float result[])
+	{
+		vector_arithmetic(n, vector_kernels_runtime().s.divide, x, y, result);
+	}
+
+	DLLEXPORT void s_vector_power(const int n, const float x[], const float y[], float result[])
+	{
+		vector_power(n, x, y, result);
+	}
+
+	DLLEXPORT void d_vector_add(const int n, const double x[], const double y[], double result[])
+	{
+		vector_arithmetic(n, vector_kernels_runtime().d.add, x, y, result);
+	}
+
+	DLLEXPORT void d_vector_subtract(const int n, const double x[], const double y[], double result[])
+	{
+		vector_arithmetic(n, vector_kernels_runtime().d.subtract, x, y, result);
+	}
+
+	DLLEXPORT void d_vector_multiply(const int n, const double x[], const double y[], double result[])
+	{
+		vector_arithmetic(n, vector_kernels_runtime().d.multiply, x, y, result);
+	}
+
+	DLLEXPORT void d_vector_divide(const int n, const double x[], const double y[], double result[])
+	{
+		vector_arithmetic(n, vector_kernels_runtime().d.divide, x, y, result);
+	}
+
+	DLLEXPORT void d_vector_power(const int n, const double x[], const double y[], double result[])
+	{
+		vector_power(n, x, y, result);
+	}
+
+	DLLEXPORT void c_vector_add(const int n, const blas_complex_float x[], const blas_complex_float y[], blas_complex_float result[])
+	{
+		vector_arithmetic<add_op>(n, reinterpret_cast<const std::complex<float>*>(x), reinterpret_cast<const std::complex<float>*>(y), reinterpret_cast<std::complex<float>*>(result));
+	}
+
+	DLLEXPORT void c_vector_subtract(const int n, const blas_complex_float x[], const blas_complex_float y[], blas_complex_float result[])
+	{
+		vector_arithmetic<subtract_op>(n, reinterpret_cast<const std::complex<float>*>(x), reinterpret_cast<const std::complex<float>*>(y), reinterpret_cast<std::complex<float>*>(result));
+	}
+
+	DLLEXPORT void c_vector_multiply(const int n, const blas_complex_float x[], const blas_complex_float y[], blas_complex_float result[])
+	{
+		vector_arithmetic<multiply_op>(n, reinterpret_cast<const std::complex<float>*>(x), reinterpret_cast<const std::complex<float>*>(y), reinterpret_cast<std::complex<float>*>(result));
+	}
+
+	DLLEXPORT void c_vector_divide(const int n, const blas_complex_float x[], const blas_complex_float y[], blas_complex_float result[])
+	{
+		vector_arithmetic<divide_op>(n, reinterpret_cast<const std::complex<float>*>(x), reinterpret_cast<const std::complex<float>*>(y), reinterpret_cast<std::complex<float>*>(result));
+	}
+
+	DLLEXPORT void c_vector_power(const int n, const blas_complex_float x[], const blas_complex_float y[], blas_complex_float result[])
+	{
+		vector_power(n, reinterpret_cast<const std::complex<float>*>(x), reinterpret_cast<const std::complex<float>*>(y), reinterpret_cast<std::complex<float>*>(result));
+	}
+
+	DLLEXPORT void z_vector_add(const int n, const blas_complex_double x[], const blas_complex_double y[], blas_complex_double result[])
+	{
+		vector_arithmetic<add_op>(n, reinterpret_cast<const std::complex<double>*>(x), reinterpret_cast<const std::complex<double>*>(y), reinterpret_cast<std::complex<double>*>(result));
+	}
+
+	DLLEXPORT void z_vector_subtract(const int n, const blas_complex_double x[], const blas_complex_double y[], blas_complex_double result[])
+	{
+		vector_arithmetic<subtract_op>(n, reinterpret_cast<const std::complex<double>*>(x), reinterpret_cast<const std::complex<double>*>(y), reinterpret_cast<std::complex<double>*>(result));
+	}
+
+	DLLEXPORT void z_vector_multiply(const int n, const blas_complex_double x[], const blas_complex_double y[], blas_complex_double result[])
+	{
+		vector_arithmetic<multiply_op>(n, reinterpret_cast<const std::complex<double>*>(x), reinterpret_cast<const std::complex<double>*>(y), reinterpret_cast<std::complex<double>*>(result));
+	}
+
+	DLLEXPORT void z_vector_divide(const int n, const blas_complex_double x[], const blas_complex_double y[], blas_complex_double result[])
+	{
+		vector_arithmetic<divide_op>(n, reinterpret_cast<const std::complex<double>*>(x), reinterpret_cast<const std::complex<double>*>(y), reinterpret_cast<std::complex<double>*>(result));
+	}
+
+	DLLEXPORT void z_vector_power(const int n, const blas_complex_double x[], const blas_complex_double y[], blas_complex_double result[])
+	{
+		vector_power(n, reinterpret_cast<const std::complex<double>*>(x), reinterpret_cast<const std::complex<double>*>(y), reinterpret_cast<std::complex<double>*>(result));
+	}
+}
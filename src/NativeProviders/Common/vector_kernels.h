@@ -0,0 +1,65 @@
+#pragma once
+
+#include "simd_common.h"
+
+/*
+	Element-wise kernels of vector_functions.cpp: result[i] = op(x[i], y[i]) for i in [begin, end).
+	The real arithmetic kernels are compiled once per dispatch target (vector_functions.cpp for the baseline,
+	vector_kernels_avx2.cpp and vector_kernels_avx512.cpp) and reached through the vector_kernels table of the
+	target picked at runtime.
+*/
+
+template<typename T>
+struct vector_kernel_table
+{
+	typedef void (*kernel)(int begin, int end, const T* x, const T* y, T* result);
+
+	kernel add;
+	kernel subtract;
+	kernel multiply;
+	kernel divide;
+};
+
+struct vector_kernels
+{
+	vector_kernel_table<float> s;
+	vector_kernel_table<double> d;
+};
+
+extern const vector_kernels vector_kernels_base;
+extern const vector_kernels vector_kernels_avx2;
+extern const vector_kernels vector_kernels_avx512;
+
+namespace SIMD_NAMESPACE {
+
+struct add_op { template<typename V> static V apply(const V a, const V b) { return simd_add(a, b); } };
+struct subtract_op { template<typename V> static V apply(const V a, const V b) { return simd_subtract(a, b); } };
+struct multiply_op { template<typename V> static V apply(const V a, const V b) { return simd_multiply(a, b); } };
+struct divide_op { template<typename V> static V apply(const V a, const V b) { return simd_divide(a, b); } };
+
+// In registers of Unit::width elements followed by a scalar tail.
+template<typename Op, typename Unit, typename T>
+void vector_kernel(const int begin, const int end, const T* x, const T* y, T* result)
+{
+	int i = begin;
+	for (; i + Unit::width <= end; i += Unit::width)
+	{
+		Unit::store(result + i, Op::apply(Unit::load(x + i), Unit::load(y + i)));
+	}
+
+	for (; i < end; ++i)
+	{
+		result[i] = Op::apply(x[i], y[i]);
+	}
+}
+
+}
+
+// Kernel table of the target the including translation unit is compiled for.
+#define VECTOR_KERNEL_TABLE(T) { \
+	&SIMD_NAMESPACE::vector_kernel<SIMD_NAMESPACE::add_op, SIMD_NAMESPACE::simd_unit<T>, T>, \
+	&SIMD_NAMESPACE::vector_kernel<SIMD_NAMESPACE::subtract_op, SIMD_NAMESPACE::simd_unit<T>, T>, \
+	&SIMD_NAMESPACE::vector_kernel<SIMD_NAMESPACE::multiply_op, SIMD_NAMESPACE::simd_unit<T>, T>, \
+	&SIMD_NAMESPACE::vector_kernel<SIMD_NAMESPACE::divide_op, SIMD_NAMESPACE::simd_unit<T>, T> }
+
+#define VECTOR_KERNELS { VECTOR_KERNEL_TABLE(float), VECTOR_KERNEL_TABLE(double) }
@@ -0,0 +1,5 @@
+// Compiled with AVX2 enabled (/arch:AVX2, -mavx2 -mfma); only called once simd_dispatch.h found AVX2 support.
+#define SIMD_KERNELS_AVX2
+#include "vector_kernels.h"
+
+extern const vector_kernels vector_kernels_avx2 = VECTOR_KERNELS;
@@ -0,0 +1,5 @@
+// Compiled with AVX-512 enabled (/arch:AVX512, -mavx512f); only called once simd_dispatch.h found AVX-512 support.
+#define SIMD_KERNELS_AVX512
+#include "vector_kernels.h"
+
+extern const vector_kernels vector_kernels_avx512 = VECTOR_KERNELS;
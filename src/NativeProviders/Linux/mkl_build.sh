@@ -6,12 +6,29 @@ export OPENMP=$INTEL/oneapi/compiler/$VERSION/linux/compiler/lib
 export OUT=../../../out/MKL/Linux
 
 mkdir -p $OUT/x64
+mkdir -p $OUT/x64-ILP64
 mkdir -p $OUT/x86
 
-g++ -std=c++11 -D_M_X64 -DGCC -m64 --shared -fPIC -o $OUT/x64/libMathNetNumericsMKL.so -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../Common/lapack.cpp ../MKL/fft.cpp -Wl,--start-group  $MKL/lib/intel64/libmkl_intel_lp64.a $MKL/lib/intel64/libmkl_intel_thread.a $MKL/lib/intel64/libmkl_core.a -Wl,--end-group -L$OPENMP/intel64_lin -liomp5 -lpthread -lm
+# Kernels picked at runtime (see ../Common/simd_dispatch.h) are compiled separately with their instruction set enabled
+export OBJ=$OUT/obj
+mkdir -p $OBJ/x64
+mkdir -p $OBJ/x86
+g++ -std=c++11 -D_M_X64 -DGCC -m64 -fPIC -mavx2 -mfma -c -o $OBJ/x64/reduction_kernels_avx2.o -I../Common ../Common/reduction_kernels_avx2.cpp
+g++ -std=c++11 -D_M_X64 -DGCC -m64 -fPIC -mavx512f -c -o $OBJ/x64/reduction_kernels_avx512.o -I../Common ../Common/reduction_kernels_avx512.cpp
+g++ -std=c++11 -D_M_IX86 -DGCC -m32 -fPIC -mavx2 -mfma -c -o $OBJ/x86/reduction_kernels_avx2.o -I../Common ../Common/reduction_kernels_avx2.cpp
+g++ -std=c++11 -D_M_IX86 -DGCC -m32 -fPIC -mavx512f -c -o $OBJ/x86/reduction_kernels_avx512.o -I../Common ../Common/reduction_kernels_avx512.cpp
+
+g++ -std=c++11 -D_M_X64 -DGCC -m64 --shared -fPIC -o $OUT/x64/libMathNetNumericsMKL.so -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../MKL/blas_batch.c ../MKL/blas_extensions.c ../MKL/blas_jit.c ../MKL/blas_pack.c ../MKL/blas_transpose.c ../MKL/sparse_blas.c ../MKL/summary_statistics.c ../MKL/random.c ../MKL/convolution.c ../MKL/data_fitting.c ../Common/reductions.cpp $OBJ/x64/reduction_kernels_avx2.o $OBJ/x64/reduction_kernels_avx512.o ../Common/lapack.cpp ../MKL/fft.cpp -Wl,--start-group  $MKL/lib/intel64/libmkl_intel_lp64.a $MKL/lib/intel64/libmkl_intel_thread.a $MKL/lib/intel64/libmkl_core.a -Wl,--end-group -L$OPENMP/intel64_lin -liomp5 -lpthread -lm
 
 cp $OPENMP/intel64_lin/libiomp5.so  $OUT/x64/
 
-g++ -std=c++11 -D_M_IX86 -DGCC -m32 --shared -fPIC -o $OUT/x86/libMathNetNumericsMKL.so -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../Common/lapack.cpp ../MKL/fft.cpp  -Wl,--start-group $MKL/lib/ia32/libmkl_intel.a $MKL/lib/ia32/libmkl_intel_thread.a $MKL/lib/ia32/libmkl_core.a -Wl,--end-group -L$OPENMP/ia32_lin -liomp5 -lpthread -lm
+# ILP64 (64-bit MKL_INT) build for native consumers only; the managed provider refuses to load it
+g++ -std=c++11 -D_M_X64 -DMKL_ILP64 -DGCC -m64 --shared -fPIC -o $OUT/x64-ILP64/libMathNetNumericsMKL.so -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../MKL/blas_batch.c ../MKL/blas_extensions.c ../MKL/blas_jit.c ../MKL/blas_pack.c ../MKL/blas_transpose.c ../MKL/sparse_blas.c ../MKL/summary_statistics.c ../MKL/random.c ../MKL/convolution.c ../MKL/data_fitting.c ../Common/reductions.cpp $OBJ/x64/reduction_kernels_avx2.o $OBJ/x64/reduction_kernels_avx512.o ../Common/lapack.cpp ../MKL/fft.cpp -Wl,--start-group  $MKL/lib/intel64/libmkl_intel_ilp64.a $MKL/lib/intel64/libmkl_intel_thread.a $MKL/lib/intel64/libmkl_core.a -Wl,--end-group -L$OPENMP/intel64_lin -liomp5 -lpthread -lm
+
+cp $OPENMP/intel64_lin/libiomp5.so  $OUT/x64-ILP64/
+
+g++ -std=c++11 -D_M_IX86 -DGCC -m32 --shared -fPIC -o $OUT/x86/libMathNetNumericsMKL.so -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../MKL/blas_batch.c ../MKL/blas_extensions.c ../MKL/blas_jit.c ../MKL/blas_pack.c ../MKL/blas_transpose.c ../MKL/sparse_blas.c ../MKL/summary_statistics.c ../MKL/random.c ../MKL/convolution.c ../MKL/data_fitting.c ../Common/reductions.cpp $OBJ/x86/reduction_kernels_avx2.o $OBJ/x86/reduction_kernels_avx512.o ../Common/lapack.cpp ../MKL/fft.cpp  -Wl,--start-group $MKL/lib/ia32/libmkl_intel.a $MKL/lib/ia32/libmkl_intel_thread.a $MKL/lib/ia32/libmkl_core.a -Wl,--end-group -L$OPENMP/ia32_lin -liomp5 -lpthread -lm
 
 cp $OPENMP/ia32_lin/libiomp5.so  $OUT/x86/
+
+rm -rf $OBJ
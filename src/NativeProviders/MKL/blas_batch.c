@@ -0,0 +1,73 @@
+#include "wrapper_common.h"
+#include "blas.h"
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/* All matrices of a batch share the same dimensions and transpose flags, which maps onto a single MKL group.
+   The group API takes its sizes by address, so they are widened into blas_int locals first. */
+
+DLLEXPORT void s_matrix_multiply_batch(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float* x[], const float* y[], const float beta, float* c[], const int batch_size){
+	const blas_int rows = m, cols = n, depth = k, size = batch_size;
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_sgemm_batch(CblasColMajor, &transA, &transB, &rows, &cols, &depth, &alpha, x, &lda, y, &ldb, &beta, c, &rows, 1, &size);
+}
+
+DLLEXPORT void d_matrix_multiply_batch(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double* x[], const double* y[], const double beta, double* c[], const int batch_size){
+	const blas_int rows = m, cols = n, depth = k, size = batch_size;
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_dgemm_batch(CblasColMajor, &transA, &transB, &rows, &cols, &depth, &alpha, x, &lda, y, &ldb, &beta, c, &rows, 1, &size);
+}
+
+DLLEXPORT void c_matrix_multiply_batch(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_float alpha, const blas_complex_float* x[], const blas_complex_float* y[], const blas_complex_float beta, blas_complex_float* c[], const int batch_size){
+	const blas_int rows = m, cols = n, depth = k, size = batch_size;
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_cgemm_batch(CblasColMajor, &transA, &transB, &rows, &cols, &depth, &alpha, (const void**)x, &lda, (const void**)y, &ldb, &beta, (void**)c, &rows, 1, &size);
+}
+
+DLLEXPORT void z_matrix_multiply_batch(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_double alpha, const blas_complex_double* x[], const blas_complex_double* y[], const blas_complex_double beta, blas_complex_double* c[], const int batch_size){
+	const blas_int rows = m, cols = n, depth = k, size = batch_size;
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_zgemm_batch(CblasColMajor, &transA, &transB, &rows, &cols, &depth, &alpha, (const void**)x, &lda, (const void**)y, &ldb, &beta, (void**)c, &rows, 1, &size);
+}
+
+DLLEXPORT void s_matrix_multiply_batch_strided(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float x[], const int xStride, const float y[], const int yStride, const float beta, float c[], const int cStride, const int batch_size){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_sgemm_batch_strided(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, xStride, y, ldb, yStride, beta, c, m, cStride, batch_size);
+}
+
+DLLEXPORT void d_matrix_multiply_batch_strided(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double x[], const int xStride, const double y[], const int yStride, const double beta, double c[], const int cStride, const int batch_size){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_dgemm_batch_strided(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, xStride, y, ldb, yStride, beta, c, m, cStride, batch_size);
+}
+
+DLLEXPORT void c_matrix_multiply_batch_strided(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_float alpha, const blas_complex_float x[], const int xStride, const blas_complex_float y[], const int yStride, const blas_complex_float beta, blas_complex_float c[], const int cStride, const int batch_size){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_cgemm_batch_strided(CblasColMajor, transA, transB, m, n, k, &alpha, x, lda, xStride, y, ldb, yStride, &beta, c, m, cStride, batch_size);
+}
+
+DLLEXPORT void z_matrix_multiply_batch_strided(CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_double alpha, const blas_complex_double x[], const int xStride, const blas_complex_double y[], const int yStride, const blas_complex_double beta, blas_complex_double c[], const int cStride, const int batch_size){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_zgemm_batch_strided(CblasColMajor, transA, transB, m, n, k, &alpha, x, lda, xStride, y, ldb, yStride, &beta, c, m, cStride, batch_size);
+}
+
+#if __cplusplus
+}
+#endif
@@ -0,0 +1,121 @@
+#include "wrapper_common.h"
+#include "blas.h"
+#include "blas_common.h"
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/*
+	C = alpha*op(x)*op(y) + beta*C on one triangle of the n x n result only (gemmt).
+	With mirror set, the computed triangle is copied into the other one afterwards;
+	complex results are mirrored conjugated only if the product is Hermitian
+	(exactly one of op(x), op(y) is a conjugate transpose), and transposed as they are otherwise.
+	A Hermitian product with complex alpha or beta has no triangle to mirror, so it is computed in full instead.
+*/
+
+DLLEXPORT void s_matrix_multiply_triangle(CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int n, const int k, const float alpha, const float x[], const float y[], const float beta, float c[], const int mirror){
+	const blas_int lda = transA == CblasNoTrans ? n : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_sgemmt(CblasColMajor, uplo, transA, transB, n, k, alpha, x, lda, y, ldb, beta, c, n);
+
+	if (mirror)
+	{
+		s_mirror_triangle(uplo == CblasUpper, n, c);
+	}
+}
+
+DLLEXPORT void d_matrix_multiply_triangle(CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int n, const int k, const double alpha, const double x[], const double y[], const double beta, double c[], const int mirror){
+	const blas_int lda = transA == CblasNoTrans ? n : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	cblas_dgemmt(CblasColMajor, uplo, transA, transB, n, k, alpha, x, lda, y, ldb, beta, c, n);
+
+	if (mirror)
+	{
+		d_mirror_triangle(uplo == CblasUpper, n, c);
+	}
+}
+
+DLLEXPORT void c_matrix_multiply_triangle(CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int n, const int k, const blas_complex_float alpha, const blas_complex_float x[], const blas_complex_float y[], const blas_complex_float beta, blas_complex_float c[], const int mirror){
+	const blas_int lda = transA == CblasNoTrans ? n : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	if (mirror && HERMITIAN_PRODUCT(transA, transB) && !REAL_SCALARS(float, alpha, beta))
+	{
+		cblas_cgemm(CblasColMajor, transA, transB, n, n, k, &alpha, x, lda, y, ldb, &beta, c, n);
+		return;
+	}
+
+	cblas_cgemmt(CblasColMajor, uplo, transA, transB, n, k, &alpha, x, lda, y, ldb, &beta, c, n);
+
+	if (mirror)
+	{
+		c_mirror_triangle(uplo == CblasUpper, HERMITIAN_PRODUCT(transA, transB), n, c);
+	}
+}
+
+DLLEXPORT void z_matrix_multiply_triangle(CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int n, const int k, const blas_complex_double alpha, const blas_complex_double x[], const blas_complex_double y[], const blas_complex_double beta, blas_complex_double c[], const int mirror){
+	const blas_int lda = transA == CblasNoTrans ? n : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+
+	if (mirror && HERMITIAN_PRODUCT(transA, transB) && !REAL_SCALARS(double, alpha, beta))
+	{
+		cblas_zgemm(CblasColMajor, transA, transB, n, n, k, &alpha, x, lda, y, ldb, &beta, c, n);
+		return;
+	}
+
+	cblas_zgemmt(CblasColMajor, uplo, transA, transB, n, k, &alpha, x, lda, y, ldb, &beta, c, n);
+
+	if (mirror)
+	{
+		z_mirror_triangle(uplo == CblasUpper, HERMITIAN_PRODUCT(transA, transB), n, c);
+	}
+}
+
+/* BLAS-1 extensions beyond the reference CBLAS interface. */
+
+DLLEXPORT void s_axpby(const int n, const float alpha, const float x[], const float beta, float y[]){
+	cblas_saxpby(n, alpha, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void d_axpby(const int n, const double alpha, const double x[], const double beta, double y[]){
+	cblas_daxpby(n, alpha, x, 1, beta, y, 1);
+}
+
+DLLEXPORT void c_axpby(const int n, const blas_complex_float alpha, const blas_complex_float x[], const blas_complex_float beta, blas_complex_float y[]){
+	cblas_caxpby(n, &alpha, x, 1, &beta, y, 1);
+}
+
+DLLEXPORT void z_axpby(const int n, const blas_complex_double alpha, const blas_complex_double x[], const blas_complex_double beta, blas_complex_double y[]){
+	cblas_zaxpby(n, &alpha, x, 1, &beta, y, 1);
+}
+
+DLLEXPORT int s_min_abs_index(const int n, const float x[]){
+	return (blas_int)cblas_isamin(n, x, 1);
+}
+
+DLLEXPORT int d_min_abs_index(const int n, const double x[]){
+	return (blas_int)cblas_idamin(n, x, 1);
+}
+
+DLLEXPORT int c_min_abs_index(const int n, const blas_complex_float x[]){
+	return (blas_int)cblas_icamin(n, x, 1);
+}
+
+DLLEXPORT int z_min_abs_index(const int n, const blas_complex_double x[]){
+	return (blas_int)cblas_izamin(n, x, 1);
+}
+
+DLLEXPORT void c_rotate_generate(blas_complex_float* a, const blas_complex_float* b, float* c, blas_complex_float* s){
+	cblas_crotg(a, b, c, s);
+}
+
+DLLEXPORT void z_rotate_generate(blas_complex_double* a, const blas_complex_double* b, double* c, blas_complex_double* s){
+	cblas_zrotg(a, b, c, s);
+}
+
+#if __cplusplus
+}
+#endif
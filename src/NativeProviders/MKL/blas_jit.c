@@ -0,0 +1,149 @@
+#include <stdlib.h>
+#include "wrapper_common.h"
+#include "blas.h"
+#include "mkl.h"
+
+/*
+	GEMM kernels specialised by MKL for one fixed (transA, transB, m, n, k, alpha, beta) configuration,
+	for small products evaluated many times. Operands are packed column-major as in ?_matrix_multiply.
+
+	Create returns MKL_JIT_SUCCESS (0) for a JIT-compiled kernel, MKL_NO_JIT (1) if MKL chose its
+	standard GEMM for this configuration (the handle is still usable), or MKL_JIT_ERROR (2).
+*/
+
+typedef struct
+{
+	void* jitter;
+	union
+	{
+		sgemm_jit_kernel_t s;
+		dgemm_jit_kernel_t d;
+		cgemm_jit_kernel_t c;
+		zgemm_jit_kernel_t z;
+	} kernel;
+} gemm_jit;
+
+static gemm_jit* gemm_jit_new(void)
+{
+	gemm_jit* jit = (gemm_jit*)malloc(sizeof(gemm_jit));
+	if (jit) jit->jitter = NULL;
+	return jit;
+}
+
+static void gemm_jit_delete(gemm_jit* jit)
+{
+	if (jit->jitter) mkl_jit_destroy(jit->jitter);
+	free(jit);
+}
+
+#if __cplusplus
+extern "C" {
+#endif
+
+DLLEXPORT int s_matrix_multiply_kernel_create(gemm_jit** handle, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float beta){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+	gemm_jit* jit = gemm_jit_new();
+	mkl_jit_status_t status;
+
+	*handle = NULL;
+	if (!jit) return MKL_JIT_ERROR;
+
+	status = mkl_jit_create_sgemm(&jit->jitter, MKL_COL_MAJOR, (MKL_TRANSPOSE)transA, (MKL_TRANSPOSE)transB, m, n, k, alpha, lda, ldb, beta, m);
+	if (status == MKL_JIT_ERROR)
+	{
+		gemm_jit_delete(jit);
+		return status;
+	}
+
+	jit->kernel.s = mkl_jit_get_sgemm_ptr(jit->jitter);
+	*handle = jit;
+	return status;
+}
+
+DLLEXPORT int d_matrix_multiply_kernel_create(gemm_jit** handle, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double beta){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+	gemm_jit* jit = gemm_jit_new();
+	mkl_jit_status_t status;
+
+	*handle = NULL;
+	if (!jit) return MKL_JIT_ERROR;
+
+	status = mkl_jit_create_dgemm(&jit->jitter, MKL_COL_MAJOR, (MKL_TRANSPOSE)transA, (MKL_TRANSPOSE)transB, m, n, k, alpha, lda, ldb, beta, m);
+	if (status == MKL_JIT_ERROR)
+	{
+		gemm_jit_delete(jit);
+		return status;
+	}
+
+	jit->kernel.d = mkl_jit_get_dgemm_ptr(jit->jitter);
+	*handle = jit;
+	return status;
+}
+
+DLLEXPORT int c_matrix_multiply_kernel_create(gemm_jit** handle, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_float alpha, const blas_complex_float beta){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+	gemm_jit* jit = gemm_jit_new();
+	mkl_jit_status_t status;
+
+	*handle = NULL;
+	if (!jit) return MKL_JIT_ERROR;
+
+	status = mkl_jit_create_cgemm(&jit->jitter, MKL_COL_MAJOR, (MKL_TRANSPOSE)transA, (MKL_TRANSPOSE)transB, m, n, k, &alpha, lda, ldb, &beta, m);
+	if (status == MKL_JIT_ERROR)
+	{
+		gemm_jit_delete(jit);
+		return status;
+	}
+
+	jit->kernel.c = mkl_jit_get_cgemm_ptr(jit->jitter);
+	*handle = jit;
+	return status;
+}
+
+DLLEXPORT int z_matrix_multiply_kernel_create(gemm_jit** handle, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const blas_complex_double alpha, const blas_complex_double beta){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	const blas_int ldb = transB == CblasNoTrans ? k : n;
+	gemm_jit* jit = gemm_jit_new();
+	mkl_jit_status_t status;
+
+	*handle = NULL;
+	if (!jit) return MKL_JIT_ERROR;
+
+	status = mkl_jit_create_zgemm(&jit->jitter, MKL_COL_MAJOR, (MKL_TRANSPOSE)transA, (MKL_TRANSPOSE)transB, m, n, k, &alpha, lda, ldb, &beta, m);
+	if (status == MKL_JIT_ERROR)
+	{
+		gemm_jit_delete(jit);
+		return status;
+	}
+
+	jit->kernel.z = mkl_jit_get_zgemm_ptr(jit->jitter);
+	*handle = jit;
+	return status;
+}
+
+DLLEXPORT void s_matrix_multiply_kernel_execute(const gemm_jit* handle, const float x[], const float y[], float c[]){
+	handle->kernel.s(handle->jitter, (float*)x, (float*)y, c);
+}
+
+DLLEXPORT void d_matrix_multiply_kernel_execute(const gemm_jit* handle, const double x[], const double y[], double c[]){
+	handle->kernel.d(handle->jitter, (double*)x, (double*)y, c);
+}
+
+DLLEXPORT void c_matrix_multiply_kernel_execute(const gemm_jit* handle, const blas_complex_float x[], const blas_complex_float y[], blas_complex_float c[]){
+	handle->kernel.c(handle->jitter, (blas_complex_float*)x, (blas_complex_float*)y, c);
+}
+
+DLLEXPORT void z_matrix_multiply_kernel_execute(const gemm_jit* handle, const blas_complex_double x[], const blas_complex_double y[], blas_complex_double c[]){
+	handle->kernel.z(handle->jitter, (blas_complex_double*)x, (blas_complex_double*)y, c);
+}
+
+DLLEXPORT void x_matrix_multiply_kernel_free(gemm_jit* handle){
+	if (handle) gemm_jit_delete(handle);
+}
+
+#if __cplusplus
+}
+#endif
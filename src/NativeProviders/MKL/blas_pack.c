@@ -0,0 +1,82 @@
+#include "wrapper_common.h"
+#include "blas.h"
+#include "mkl.h"
+
+/*
+	GEMM with a pre-packed A operand, for multiplying one fixed matrix against many right hand sides.
+	?_matrix_multiply_pack packs alpha*op(A) (m x k, column-major) once into MKL's internal format;
+	?_matrix_multiply_packed then computes C = packed*op(B) + beta*C for any number of columns n.
+	The packed buffer is allocated through mkl_malloc, so it shows up in mem_stat/peak_mem_usage,
+	and must be released with x_matrix_multiply_pack_free. Pack returns 0 on success, 1 if out of memory.
+*/
+
+typedef struct
+{
+	blas_int m;
+	blas_int k;
+	void* data;
+} gemm_packed;
+
+static gemm_packed* gemm_packed_new(const blas_int m, const blas_int k, const size_t size)
+{
+	gemm_packed* packed = (gemm_packed*)mkl_malloc(sizeof(gemm_packed), 64);
+	if (!packed) return NULL;
+
+	packed->m = m;
+	packed->k = k;
+	packed->data = mkl_malloc(size, 64);
+	if (!packed->data)
+	{
+		mkl_free(packed);
+		return NULL;
+	}
+
+	return packed;
+}
+
+#if __cplusplus
+extern "C" {
+#endif
+
+DLLEXPORT int s_matrix_multiply_pack(gemm_packed** handle, CBLAS_TRANSPOSE transA, const int m, const int k, const float alpha, const float a[]){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	gemm_packed* packed = gemm_packed_new(m, k, cblas_sgemm_pack_get_size(CblasAMatrix, m, 1, k));
+
+	*handle = packed;
+	if (!packed) return 1;
+
+	cblas_sgemm_pack(CblasColMajor, CblasAMatrix, transA, m, 1, k, alpha, a, lda, (float*)packed->data);
+	return 0;
+}
+
+DLLEXPORT int d_matrix_multiply_pack(gemm_packed** handle, CBLAS_TRANSPOSE transA, const int m, const int k, const double alpha, const double a[]){
+	const blas_int lda = transA == CblasNoTrans ? m : k;
+	gemm_packed* packed = gemm_packed_new(m, k, cblas_dgemm_pack_get_size(CblasAMatrix, m, 1, k));
+
+	*handle = packed;
+	if (!packed) return 1;
+
+	cblas_dgemm_pack(CblasColMajor, CblasAMatrix, transA, m, 1, k, alpha, a, lda, (double*)packed->data);
+	return 0;
+}
+
+DLLEXPORT void s_matrix_multiply_packed(const gemm_packed* handle, CBLAS_TRANSPOSE transB, const int n, const float y[], const float beta, float c[]){
+	const blas_int ldb = transB == CblasNoTrans ? handle->k : n;
+	cblas_sgemm_compute(CblasColMajor, CblasPacked, transB, handle->m, n, handle->k, (const float*)handle->data, handle->m, y, ldb, beta, c, handle->m);
+}
+
+DLLEXPORT void d_matrix_multiply_packed(const gemm_packed* handle, CBLAS_TRANSPOSE transB, const int n, const double y[], const double beta, double c[]){
+	const blas_int ldb = transB == CblasNoTrans ? handle->k : n;
+	cblas_dgemm_compute(CblasColMajor, CblasPacked, transB, handle->m, n, handle->k, (const double*)handle->data, handle->m, y, ldb, beta, c, handle->m);
+}
+
+DLLEXPORT void x_matrix_multiply_pack_free(gemm_packed* handle){
+	if (!handle) return;
+
+	mkl_free(handle->data);
+	mkl_free(handle);
+}
+
+#if __cplusplus
+}
+#endif
@@ -0,0 +1,64 @@
+#include "wrapper_common.h"
+#include "blas.h"
+#include "mkl.h"
+
+/*
+	Scaled matrix copy/transpose via mkl_?omatcopy (out-of-place) and mkl_?imatcopy (in-place).
+	a is a column-major rows x cols matrix; b (or ab after the in-place call) receives alpha*op(a),
+	which is cols x rows for (conjugate) transposes and rows x cols for CblasNoTrans.
+	The in-place variant returns 0 on success, matching the portable implementation.
+*/
+
+static char transpose_char(const CBLAS_TRANSPOSE trans)
+{
+	switch (trans)
+	{
+	case CblasTrans: return 'T';
+	case CblasConjTrans: return 'C';
+	default: return 'N';
+	}
+}
+
+#if __cplusplus
+extern "C" {
+#endif
+
+DLLEXPORT void s_transpose(CBLAS_TRANSPOSE trans, const int rows, const int cols, const float alpha, const float a[], float b[]){
+	mkl_somatcopy('C', transpose_char(trans), rows, cols, alpha, a, rows, b, trans == CblasNoTrans ? rows : cols);
+}
+
+DLLEXPORT void d_transpose(CBLAS_TRANSPOSE trans, const int rows, const int cols, const double alpha, const double a[], double b[]){
+	mkl_domatcopy('C', transpose_char(trans), rows, cols, alpha, a, rows, b, trans == CblasNoTrans ? rows : cols);
+}
+
+DLLEXPORT void c_transpose(CBLAS_TRANSPOSE trans, const int rows, const int cols, const blas_complex_float alpha, const blas_complex_float a[], blas_complex_float b[]){
+	mkl_comatcopy('C', transpose_char(trans), rows, cols, alpha, a, rows, b, trans == CblasNoTrans ? rows : cols);
+}
+
+DLLEXPORT void z_transpose(CBLAS_TRANSPOSE trans, const int rows, const int cols, const blas_complex_double alpha, const blas_complex_double a[], blas_complex_double b[]){
+	mkl_zomatcopy('C', transpose_char(trans), rows, cols, alpha, a, rows, b, trans == CblasNoTrans ? rows : cols);
+}
+
+DLLEXPORT int s_transpose_inplace(CBLAS_TRANSPOSE trans, const int rows, const int cols, const float alpha, float ab[]){
+	mkl_simatcopy('C', transpose_char(trans), rows, cols, alpha, ab, rows, trans == CblasNoTrans ? rows : cols);
+	return 0;
+}
+
+DLLEXPORT int d_transpose_inplace(CBLAS_TRANSPOSE trans, const int rows, const int cols, const double alpha, double ab[]){
+	mkl_dimatcopy('C', transpose_char(trans), rows, cols, alpha, ab, rows, trans == CblasNoTrans ? rows : cols);
+	return 0;
+}
+
+DLLEXPORT int c_transpose_inplace(CBLAS_TRANSPOSE trans, const int rows, const int cols, const blas_complex_float alpha, blas_complex_float ab[]){
+	mkl_cimatcopy('C', transpose_char(trans), rows, cols, alpha, ab, rows, trans == CblasNoTrans ? rows : cols);
+	return 0;
+}
+
+DLLEXPORT int z_transpose_inplace(CBLAS_TRANSPOSE trans, const int rows, const int cols, const blas_complex_double alpha, blas_complex_double ab[]){
+	mkl_zimatcopy('C', transpose_char(trans), rows, cols, alpha, ab, rows, trans == CblasNoTrans ? rows : cols);
+	return 0;
+}
+
+#if __cplusplus
+}
+#endif
@@ -21,7 +21,7 @@ extern "C" {
 		case 1:	return -1;
 
 		case 4: return sizeof(size_t);    // 4 (x86), 8 (x64)
-		case 5: return sizeof(MKL_INT);   // 4 (both)
+		case 5: return sizeof(MKL_INT);   // 4 (both), 8 (ILP64, native consumers only)
 		case 6: return sizeof(MKL_LONG);  // 4 (both)
 		case 7: return sizeof(MKL_INT64); // 8 (both)
 
@@ -73,27 +73,41 @@ extern "C" {
 
 		// LINEAR ALGEBRA
 		case 128: return 2;	// basic dense linear algebra (major - breaking)
-		case 129: return 0;	// basic dense linear algebra (minor - non-breaking)
+		case 129: return 10;	// basic dense linear algebra (minor - non-breaking)
 		case 130: return 0;	// vector functions (major - breaking)
-		case 131: return 1;	// vector functions (minor - non-breaking)
+		case 131: return 4;	// vector functions (minor - non-breaking)
 
 		// OPTIMIZATION
 		case 256: return 0; // basic optimization
 
 		// FFT
 		case 384: return 1; // basic FFT (major - breaking)
-		case 385: return 0; // basic FFT (minor - non-breaking)
+		case 385: return 4; // basic FFT (minor - non-breaking)
 
         // SPARSE SOLVER
         case 512: return 1; // direct sparse solver (major - breaking)
         case 513: return 0; // direct sparse solver (minor - non-breaking)
+        case 514: return 1; // sparse BLAS (major - breaking)
+        case 515: return 1; // sparse BLAS (minor - non-breaking)
+
+        // STATISTICS
+        case 640: return 1; // summary statistics (major - breaking)
+        case 641: return 0; // summary statistics (minor - non-breaking)
+        case 642: return 1; // random number streams (major - breaking)
+        case 643: return 0; // random number streams (minor - non-breaking)
+        case 644: return 1; // convolution and correlation (major - breaking)
+        case 645: return 0; // convolution and correlation (minor - non-breaking)
+
+        // DATA FITTING
+        case 646: return 1; // splines (major - breaking)
+        case 647: return 0; // splines (minor - non-breaking)
 
 		default: return 0; // unknown or not supported
 
 		}
 	}
 
-	DLLEXPORT void set_consistency_mode(const MKL_INT mode)
+	DLLEXPORT void set_consistency_mode(const int mode)
 	{
 		mkl_cbwr_set(mode);
 	}
@@ -103,7 +117,7 @@ extern "C" {
 		vmlSetMode(mode);
 	}
 
-	DLLEXPORT void set_max_threads(const MKL_INT num_threads)
+	DLLEXPORT void set_max_threads(const int num_threads)
 	{
 		mkl_set_num_threads(num_threads);
 	}
@@ -0,0 +1,231 @@
+#include <string.h>
+#include "wrapper_common.h"
+#include "convolution.h"
+#include "mkl.h"
+
+/*
+    Notes: ?_convolution_create sets up a convolution (or, if correlation is set, a correlation) task
+    for a fixed kernel; ?_convolution_execute then applies it to one signal at a time, and
+    x_convolution_free releases it. Kernel, signal and result are dense column-major arrays of
+    1 to CONVOLUTION_MAX_DIMENSIONS dimensions with the given shapes.
+
+    mode is one of the VSL_CONV_MODE_* values: 0 (auto) lets MKL choose between direct summation
+    and FFT for the given shapes, 1 forces direct summation and 2 forces FFT.
+    The full result of each dimension is kernelShape + signalShape - 1 long. A shorter resultShape
+    selects a window of it, starting at start (or at VSL's default if start is NULL: 0 for convolution,
+    -(kernelShape - 1) for correlation); e.g. the centered "same" convolution uses
+    resultShape = signalShape and start = (kernelShape - 1) / 2.
+    All functions return a VSL status (0 on success).
+*/
+
+static void convolution_free(convolution* conv)
+{
+    if (conv->task)
+    {
+        if (conv->correlation) vslCorrDeleteTask(&conv->task);
+        else vslConvDeleteTask(&conv->task);
+    }
+
+    mkl_free(conv->kernel);
+    mkl_free(conv);
+}
+
+static int convolution_valid(const int dimensions, const int kernelShape[], const int signalShape[], const int resultShape[])
+{
+    int i;
+    if (dimensions < 1 || dimensions > CONVOLUTION_MAX_DIMENSIONS) return 0;
+
+    for (i = 0; i < dimensions; ++i)
+    {
+        if (kernelShape[i] <= 0 || signalShape[i] <= 0 || resultShape[i] <= 0) return 0;
+    }
+
+    return 1;
+}
+
+// Column-major element strides of a dense array with the given shape.
+static void convolution_strides(const MKL_INT dimensions, const MKL_INT shape[], MKL_INT strides[])
+{
+    MKL_INT i;
+    strides[0] = 1;
+    for (i = 1; i < dimensions; ++i)
+    {
+        strides[i] = strides[i - 1] * shape[i - 1];
+    }
+}
+
+// Allocates the handle with a copy of the kernel; shapes receives the kernel, signal and result shapes as MKL_INT.
+static convolution* convolution_new(const int correlation, const int dimensions, const int kernelShape[], const int signalShape[], const int resultShape[],
+    const void* kernel, const size_t valueSize, MKL_INT shapes[3][CONVOLUTION_MAX_DIMENSIONS])
+{
+    size_t length = 1;
+    int i;
+    convolution* conv = (convolution*)mkl_calloc(1, sizeof(convolution), 64);
+    if (!conv) return NULL;
+
+    conv->correlation = correlation;
+    conv->dimensions = dimensions;
+
+    for (i = 0; i < dimensions; ++i)
+    {
+        shapes[0][i] = kernelShape[i];
+        shapes[1][i] = signalShape[i];
+        shapes[2][i] = resultShape[i];
+        length *= (size_t)kernelShape[i];
+    }
+
+    convolution_strides(conv->dimensions, shapes[0], conv->kernel_strides);
+    convolution_strides(conv->dimensions, shapes[1], conv->signal_strides);
+    convolution_strides(conv->dimensions, shapes[2], conv->result_strides);
+
+    conv->kernel = mkl_malloc(length * valueSize, 64);
+    if (!conv->kernel)
+    {
+        convolution_free(conv);
+        return NULL;
+    }
+
+    memcpy(conv->kernel, kernel, length * valueSize);
+    return conv;
+}
+
+static int convolution_start(convolution* conv, const int start[])
+{
+    MKL_INT offsets[CONVOLUTION_MAX_DIMENSIONS];
+    MKL_INT i;
+    if (!start) return VSL_STATUS_OK;
+
+    for (i = 0; i < conv->dimensions; ++i)
+    {
+        offsets[i] = start[i];
+    }
+
+    return conv->correlation ? vslCorrSetStart(conv->task, offsets) : vslConvSetStart(conv->task, offsets);
+}
+
+// Completes a handle whose task was just created, or frees it if either step failed.
+static int convolution_finish(convolution** handle, convolution* conv, int status, const int start[])
+{
+    if (status == VSL_STATUS_OK) status = convolution_start(conv, start);
+    if (status != VSL_STATUS_OK)
+    {
+        convolution_free(conv);
+        return status;
+    }
+
+    *handle = conv;
+    return VSL_STATUS_OK;
+}
+
+#if __cplusplus
+extern "C" {
+#endif
+
+    DLLEXPORT int s_convolution_create(convolution** handle, const int correlation, const int mode, const int dimensions,
+        const int kernelShape[], const int signalShape[], const int resultShape[], const int start[], const float kernel[])
+    {
+        MKL_INT shapes[3][CONVOLUTION_MAX_DIMENSIONS];
+        convolution* conv;
+        int status;
+        *handle = NULL;
+        if (!convolution_valid(dimensions, kernelShape, signalShape, resultShape)) return VSL_ERROR_BADARGS;
+
+        conv = convolution_new(correlation, dimensions, kernelShape, signalShape, resultShape, kernel, sizeof(float), shapes);
+        if (!conv) return VSL_ERROR_MEM_FAILURE;
+
+        status = correlation
+            ? vslsCorrNewTaskX(&conv->task, mode, conv->dimensions, shapes[0], shapes[1], shapes[2], (const float*)conv->kernel, conv->kernel_strides)
+            : vslsConvNewTaskX(&conv->task, mode, conv->dimensions, shapes[0], shapes[1], shapes[2], (const float*)conv->kernel, conv->kernel_strides);
+        return convolution_finish(handle, conv, status, start);
+    }
+
+    DLLEXPORT int d_convolution_create(convolution** handle, const int correlation, const int mode, const int dimensions,
+        const int kernelShape[], const int signalShape[], const int resultShape[], const int start[], const double kernel[])
+    {
+        MKL_INT shapes[3][CONVOLUTION_MAX_DIMENSIONS];
+        convolution* conv;
+        int status;
+        *handle = NULL;
+        if (!convolution_valid(dimensions, kernelShape, signalShape, resultShape)) return VSL_ERROR_BADARGS;
+
+        conv = convolution_new(correlation, dimensions, kernelShape, signalShape, resultShape, kernel, sizeof(double), shapes);
+        if (!conv) return VSL_ERROR_MEM_FAILURE;
+
+        status = correlation
+            ? vsldCorrNewTaskX(&conv->task, mode, conv->dimensions, shapes[0], shapes[1], shapes[2], (const double*)conv->kernel, conv->kernel_strides)
+            : vsldConvNewTaskX(&conv->task, mode, conv->dimensions, shapes[0], shapes[1], shapes[2], (const double*)conv->kernel, conv->kernel_strides);
+        return convolution_finish(handle, conv, status, start);
+    }
+
+    DLLEXPORT int c_convolution_create(convolution** handle, const int correlation, const int mode, const int dimensions,
+        const int kernelShape[], const int signalShape[], const int resultShape[], const int start[], const MKL_Complex8 kernel[])
+    {
+        MKL_INT shapes[3][CONVOLUTION_MAX_DIMENSIONS];
+        convolution* conv;
+        int status;
+        *handle = NULL;
+        if (!convolution_valid(dimensions, kernelShape, signalShape, resultShape)) return VSL_ERROR_BADARGS;
+
+        conv = convolution_new(correlation, dimensions, kernelShape, signalShape, resultShape, kernel, sizeof(MKL_Complex8), shapes);
+        if (!conv) return VSL_ERROR_MEM_FAILURE;
+
+        status = correlation
+            ? vslcCorrNewTaskX(&conv->task, mode, conv->dimensions, shapes[0], shapes[1], shapes[2], (const MKL_Complex8*)conv->kernel, conv->kernel_strides)
+            : vslcConvNewTaskX(&conv->task, mode, conv->dimensions, shapes[0], shapes[1], shapes[2], (const MKL_Complex8*)conv->kernel, conv->kernel_strides);
+        return convolution_finish(handle, conv, status, start);
+    }
+
+    DLLEXPORT int z_convolution_create(convolution** handle, const int correlation, const int mode, const int dimensions,
+        const int kernelShape[], const int signalShape[], const int resultShape[], const int start[], const MKL_Complex16 kernel[])
+    {
+        MKL_INT shapes[3][CONVOLUTION_MAX_DIMENSIONS];
+        convolution* conv;
+        int status;
+        *handle = NULL;
+        if (!convolution_valid(dimensions, kernelShape, signalShape, resultShape)) return VSL_ERROR_BADARGS;
+
+        conv = convolution_new(correlation, dimensions, kernelShape, signalShape, resultShape, kernel, sizeof(MKL_Complex16), shapes);
+        if (!conv) return VSL_ERROR_MEM_FAILURE;
+
+        status = correlation
+            ? vslzCorrNewTaskX(&conv->task, mode, conv->dimensions, shapes[0], shapes[1], shapes[2], (const MKL_Complex16*)conv->kernel, conv->kernel_strides)
+            : vslzConvNewTaskX(&conv->task, mode, conv->dimensions, shapes[0], shapes[1], shapes[2], (const MKL_Complex16*)conv->kernel, conv->kernel_strides);
+        return convolution_finish(handle, conv, status, start);
+    }
+
+    DLLEXPORT int s_convolution_execute(const convolution* handle, const float signal[], float result[])
+    {
+        return handle->correlation
+            ? vslsCorrExecX(handle->task, signal, handle->signal_strides, result, handle->result_strides)
+            : vslsConvExecX(handle->task, signal, handle->signal_strides, result, handle->result_strides);
+    }
+
+    DLLEXPORT int d_convolution_execute(const convolution* handle, const double signal[], double result[])
+    {
+        return handle->correlation
+            ? vsldCorrExecX(handle->task, signal, handle->signal_strides, result, handle->result_strides)
+            : vsldConvExecX(handle->task, signal, handle->signal_strides, result, handle->result_strides);
+    }
+
+    DLLEXPORT int c_convolution_execute(const convolution* handle, const MKL_Complex8 signal[], MKL_Complex8 result[])
+    {
+        return handle->correlation
+            ? vslcCorrExecX(handle->task, signal, handle->signal_strides, result, handle->result_strides)
+            : vslcConvExecX(handle->task, signal, handle->signal_strides, result, handle->result_strides);
+    }
+
+    DLLEXPORT int z_convolution_execute(const convolution* handle, const MKL_Complex16 signal[], MKL_Complex16 result[])
+    {
+        return handle->correlation
+            ? vslzCorrExecX(handle->task, signal, handle->signal_strides, result, handle->result_strides)
+            : vslzConvExecX(handle->task, signal, handle->signal_strides, result, handle->result_strides);
+    }
+
+    DLLEXPORT void x_convolution_free(convolution* handle)
+    {
+        if (handle) convolution_free(handle);
+    }
+
+#if __cplusplus
+}
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "mkl_vsl.h"
+#include "mkl_types.h"
+
+#define CONVOLUTION_MAX_DIMENSIONS 7
+
+/*
+    A VSL convolution or correlation task with a fixed kernel, executed against any number of signals.
+    MKL may keep pointers to the kernel, so the handle owns a copy of it; the strides of the dense
+    column-major signal and result arrays are precomputed for the ExecX calls.
+*/
+typedef struct
+{
+    VSLConvTaskPtr task;
+    int correlation;
+    MKL_INT dimensions;
+    MKL_INT kernel_strides[CONVOLUTION_MAX_DIMENSIONS];
+    MKL_INT signal_strides[CONVOLUTION_MAX_DIMENSIONS];
+    MKL_INT result_strides[CONVOLUTION_MAX_DIMENSIONS];
+    void* kernel;
+} convolution;
@@ -0,0 +1,157 @@
+#include <string.h>
+#include "wrapper_common.h"
+#include "data_fitting.h"
+#include "mkl.h"
+
+/*
+    Notes: ?_spline_create constructs `functions` splines over the same `knots` strictly increasing
+    partition points x at once; y holds the values of each function contiguously (knots values per
+    function, one function after another). order, type and boundary are the DF_PP_* order
+    (e.g. DF_PP_LINEAR, DF_PP_CUBIC), DF_PP_* type (e.g. DF_PP_NATURAL, DF_PP_AKIMA, DF_PP_BESSEL)
+    and DF_BC_* boundary condition flags; boundaryValues holds the values the boundary conditions
+    need, if any (e.g. the end point derivatives), and may otherwise be NULL.
+
+    ?_spline_interpolate evaluates all splines and their first `derivatives` derivatives at the given
+    sites. Sorted sites are searched incrementally, which makes each lookup O(1) for monotone queries;
+    for unsorted sites a non-negative cellHint gives the most likely interval [x[cellHint], x[cellHint + 1])
+    to start the search from (MKL numbers cells from 1 for these intervals, 0 being (-inf, x[0])). The derivative k of function j at site i is written to
+    result[(j * sites + i) * (derivatives + 1) + k].
+    Finally x_spline_free. All functions return a Data Fitting status (0 on success).
+*/
+
+static void spline_free(spline* s)
+{
+    if (s->task) dfDeleteTask(&s->task);
+    mkl_free(s->partition);
+    mkl_free(s->coefficients);
+    mkl_free(s);
+}
+
+// Allocates the handle with a copy of the partition and room for the coefficients of all cells of all functions.
+static spline* spline_new(const int order, const int knots, const int functions, const void* x, const size_t valueSize)
+{
+    spline* s = (spline*)mkl_calloc(1, sizeof(spline), 64);
+    if (!s) return NULL;
+
+    s->order = order;
+    s->knots = knots;
+    s->functions = functions;
+    s->partition = mkl_malloc((size_t)knots * valueSize, 64);
+    s->coefficients = mkl_malloc((size_t)functions * (knots - 1) * order * valueSize, 64);
+    if (!s->partition || !s->coefficients)
+    {
+        spline_free(s);
+        return NULL;
+    }
+
+    memcpy(s->partition, x, (size_t)knots * valueSize);
+    return s;
+}
+
+static int spline_valid(const int order, const int knots, const int functions)
+{
+    if (knots < 2) return DF_ERROR_BAD_NX;
+    if (functions < 1) return DF_ERROR_BAD_NY;
+    if (order < 1 || order > SPLINE_MAX_ORDER) return DF_ERROR_BAD_NDORDER;
+    return DF_STATUS_OK;
+}
+
+// Requests all derivative orders up to `derivatives`.
+static int spline_derivative_orders(const spline* s, const int derivatives, MKL_INT orders[])
+{
+    int k;
+    if (derivatives < 0 || derivatives >= s->order) return DF_ERROR_BAD_NDORDER;
+
+    for (k = 0; k <= derivatives; ++k)
+    {
+        orders[k] = 1;
+    }
+
+    return DF_STATUS_OK;
+}
+
+// Completes a handle whose task was just created, or frees it if any step failed.
+static int spline_finish(spline** handle, spline* s, int status)
+{
+    if (status != DF_STATUS_OK)
+    {
+        spline_free(s);
+        return status;
+    }
+
+    *handle = s;
+    return DF_STATUS_OK;
+}
+
+#if __cplusplus
+extern "C" {
+#endif
+
+    DLLEXPORT int s_spline_create(spline** handle, const int order, const int type, const int boundary, const float boundaryValues[],
+        const int knots, const float x[], const int functions, const float y[])
+    {
+        spline* s;
+        int status = spline_valid(order, knots, functions);
+        *handle = NULL;
+        if (status != DF_STATUS_OK) return status;
+
+        s = spline_new(order, knots, functions, x, sizeof(float));
+        if (!s) return DF_ERROR_MEM_FAILURE;
+
+        status = dfsNewTask1D(&s->task, s->knots, (const float*)s->partition, DF_NON_UNIFORM_PARTITION, s->functions, y, DF_MATRIX_STORAGE_ROWS);
+        if (status == DF_STATUS_OK) status = dfsEditPPSpline1D(s->task, s->order, type, boundary, boundaryValues, DF_NO_IC, NULL, (float*)s->coefficients, DF_NO_HINT);
+        if (status == DF_STATUS_OK) status = dfsConstruct1D(s->task, DF_PP_SPLINE, DF_METHOD_STD);
+        return spline_finish(handle, s, status);
+    }
+
+    DLLEXPORT int d_spline_create(spline** handle, const int order, const int type, const int boundary, const double boundaryValues[],
+        const int knots, const double x[], const int functions, const double y[])
+    {
+        spline* s;
+        int status = spline_valid(order, knots, functions);
+        *handle = NULL;
+        if (status != DF_STATUS_OK) return status;
+
+        s = spline_new(order, knots, functions, x, sizeof(double));
+        if (!s) return DF_ERROR_MEM_FAILURE;
+
+        status = dfdNewTask1D(&s->task, s->knots, (const double*)s->partition, DF_NON_UNIFORM_PARTITION, s->functions, y, DF_MATRIX_STORAGE_ROWS);
+        if (status == DF_STATUS_OK) status = dfdEditPPSpline1D(s->task, s->order, type, boundary, boundaryValues, DF_NO_IC, NULL, (double*)s->coefficients, DF_NO_HINT);
+        if (status == DF_STATUS_OK) status = dfdConstruct1D(s->task, DF_PP_SPLINE, DF_METHOD_STD);
+        return spline_finish(handle, s, status);
+    }
+
+    DLLEXPORT int s_spline_interpolate(const spline* handle, const int sites, const float x[], const int sorted, const int cellHint,
+        const int derivatives, float result[])
+    {
+        MKL_INT orders[SPLINE_MAX_ORDER];
+        const float hint[4] = { 1.0f, (float)DF_APRIORI_MOST_LIKELY_CELL, 1.0f, (float)(cellHint + 1) };
+        const int status = spline_derivative_orders(handle, derivatives, orders);
+        if (status != DF_STATUS_OK) return status;
+        if (sites <= 0) return DF_STATUS_OK;
+
+        return dfsInterpolate1D(handle->task, DF_INTERP, DF_METHOD_PP, sites, x, sorted ? DF_SORTED_DATA : DF_NO_HINT,
+            derivatives + 1, orders, (!sorted && cellHint >= 0) ? hint : NULL, result, DF_MATRIX_STORAGE_FUNCS_SITES_DERS, NULL);
+    }
+
+    DLLEXPORT int d_spline_interpolate(const spline* handle, const int sites, const double x[], const int sorted, const int cellHint,
+        const int derivatives, double result[])
+    {
+        MKL_INT orders[SPLINE_MAX_ORDER];
+        const double hint[4] = { 1.0, (double)DF_APRIORI_MOST_LIKELY_CELL, 1.0, (double)(cellHint + 1) };
+        const int status = spline_derivative_orders(handle, derivatives, orders);
+        if (status != DF_STATUS_OK) return status;
+        if (sites <= 0) return DF_STATUS_OK;
+
+        return dfdInterpolate1D(handle->task, DF_INTERP, DF_METHOD_PP, sites, x, sorted ? DF_SORTED_DATA : DF_NO_HINT,
+            derivatives + 1, orders, (!sorted && cellHint >= 0) ? hint : NULL, result, DF_MATRIX_STORAGE_FUNCS_SITES_DERS, NULL);
+    }
+
+    DLLEXPORT void x_spline_free(spline* handle)
+    {
+        if (handle) spline_free(handle);
+    }
+
+#if __cplusplus
+}
+#endif
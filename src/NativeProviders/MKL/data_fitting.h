@@ -0,0 +1,21 @@
+#pragma once
+
+#include "mkl_df.h"
+#include "mkl_types.h"
+
+#define SPLINE_MAX_ORDER 16
+
+/*
+    A constructed Data Fitting task of one or more piecewise polynomial splines over a shared partition.
+    MKL keeps pointers to the partition and the spline coefficients, so both live in the handle;
+    values are float or double depending on the precision the handle was created with.
+*/
+typedef struct
+{
+    DFTaskPtr task;
+    MKL_INT order;
+    MKL_INT knots;
+    MKL_INT functions;
+    void* partition;
+    void* coefficients;
+} spline;
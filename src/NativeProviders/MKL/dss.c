@@ -1,150 +1,96 @@
 #include "wrapper_common.h"
 #include "dss.h"
-
-#if __cplusplus
-extern "C" {
-#endif
-
-    // Notes: zero-based indexing is used for rowIdx[] and colPtr[].
-
-    DLLEXPORT dss_int s_dss_solve(const dss_int matrixStructure, const dss_int matrixType, const dss_int systemType,
-        const dss_int nRows, const dss_int nCols, const dss_int nnz, const dss_int rowIdx[], const dss_int colPtr[], const float values[],
-        const dss_int nRhs, const float rhsValues[], float solValues[])
+#include "mkl.h"
+
+// Notes: zero-based indexing is used for rowIdx[] and colPtr[].
+// The exported integers are 32-bit; DSS takes every integer by address as dss_int (64-bit in ILP64 builds),
+// so the arguments are widened into locals and the structure arrays into a buffer that outlives the solver.
+
+static int dss_solve_system(const int isComplex, const int matrixStructure, const int matrixType, const int systemType,
+    const int nRows, const int nCols, const int nnz, const int rowIdx[], const int colPtr[], const void* values,
+    const int nRhs, const void* rhsValues, void* solValues)
+{
+    _MKL_DSS_HANDLE_t handle;
+    dss_int error;
+    dss_int structure = matrixStructure, type = matrixType, rows = nRows, cols = nCols, nonZeros = nnz, rhs = nRhs;
+    dss_int* indices;
+    dss_int i;
+
+    dss_int opt = MKL_DSS_MSG_LVL_WARNING + MKL_DSS_TERM_LVL_ERROR + MKL_DSS_ZERO_BASED_INDEXING + MKL_DSS_AUTO_ORDER;
+    opt += systemType;
+
+    // Widen the row pointers (nRows + 1) followed by the column indices (nnz)
+    indices = (dss_int*)mkl_malloc(((size_t)nRows + 1 + (size_t)nnz) * sizeof(dss_int), 64);
+    if (!indices) return MKL_DSS_OUT_OF_MEMORY;
+
+    for (i = 0; i <= rows; ++i)
     {
-        _MKL_DSS_HANDLE_t handle;
-        dss_int error;
-
-        dss_int opt = MKL_DSS_MSG_LVL_WARNING + MKL_DSS_TERM_LVL_ERROR + MKL_DSS_ZERO_BASED_INDEXING + MKL_DSS_AUTO_ORDER;
-        opt += systemType;
-
-        // Initialize the solver
-        error = dss_create(handle, opt);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Define the non-zero structure of the matrix
-        error = dss_define_structure(handle, matrixStructure, rowIdx, nRows, nCols, colPtr, nnz);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Reorder the matrix
-        error = dss_reorder(handle, opt, 0);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Factor the matrix
-        error = dss_factor_real(handle, matrixType, values);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Get the solution vector
-        error = dss_solve_real(handle, opt, rhsValues, nRhs, solValues);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Deallocate solver storage
-        error = dss_delete(handle, opt);
-        return error;
+        indices[i] = rowIdx[i];
     }
 
-    DLLEXPORT dss_int d_dss_solve(const dss_int matrixStructure, const dss_int matrixType, const dss_int systemType,
-        const dss_int nRows, const dss_int nCols, const dss_int nnz, const dss_int rowIdx[], const dss_int colPtr[], const double values[],
-        const dss_int nRhs, const double rhsValues[], double solValues[])
+    for (i = 0; i < nonZeros; ++i)
     {
-        _MKL_DSS_HANDLE_t handle;
-        dss_int error;
-
-        dss_int opt = MKL_DSS_MSG_LVL_WARNING + MKL_DSS_TERM_LVL_ERROR + MKL_DSS_ZERO_BASED_INDEXING + MKL_DSS_AUTO_ORDER;
-        opt += systemType;
-
-        // Initialize the solver
-        error = dss_create(handle, opt);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Define the non-zero structure of the matrix
-        error = dss_define_structure(handle, matrixStructure, rowIdx, nRows, nCols, colPtr, nnz);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Reorder the matrix
-        error = dss_reorder(handle, opt, 0);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Factor the matrix
-        error = dss_factor_real(handle, matrixType, values);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Get the solution vector
-        error = dss_solve_real(handle, opt, rhsValues, nRhs, solValues);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Deallocate solver storage
-        error = dss_delete(handle, opt);
-        return error;
+        indices[rows + 1 + i] = colPtr[i];
     }
 
-    DLLEXPORT dss_int c_dss_solve(const dss_int matrixStructure, const dss_int matrixType, const dss_int systemType,
-        const dss_int nRows, const dss_int nCols, const dss_int nnz, const dss_int rowIdx[], const dss_int colPtr[], const dss_complex_float values[],
-        const dss_int nRhs, const dss_complex_float rhsValues[], dss_complex_float solValues[])
+    // Initialize the solver
+    error = dss_create(handle, opt);
+    if (error != MKL_DSS_SUCCESS)
     {
-        _MKL_DSS_HANDLE_t handle;
-        dss_int error;
+        mkl_free(indices);
+        return (int)error;
+    }
 
-        dss_int opt = MKL_DSS_MSG_LVL_WARNING + MKL_DSS_TERM_LVL_ERROR + MKL_DSS_ZERO_BASED_INDEXING + MKL_DSS_AUTO_ORDER;
-        opt += systemType;
+    // Define the non-zero structure of the matrix
+    error = dss_define_structure(handle, structure, indices, rows, cols, indices + rows + 1, nonZeros);
 
-        // Initialize the solver
-        error = dss_create(handle, opt);
-        if (error != MKL_DSS_SUCCESS) return error;
+    // Reorder the matrix
+    if (error == MKL_DSS_SUCCESS) error = dss_reorder(handle, opt, 0);
 
-        // Define the non-zero structure of the matrix
-        error = dss_define_structure(handle, matrixStructure, rowIdx, nRows, nCols, colPtr, nnz);
-        if (error != MKL_DSS_SUCCESS) return error;
+    // Factor the matrix
+    if (error == MKL_DSS_SUCCESS) error = isComplex ? dss_factor_complex(handle, type, values) : dss_factor_real(handle, type, values);
 
-        // Reorder the matrix
-        error = dss_reorder(handle, opt, 0);
-        if (error != MKL_DSS_SUCCESS) return error;
+    // Get the solution vector
+    if (error == MKL_DSS_SUCCESS) error = dss_solve_real(handle, opt, rhsValues, rhs, solValues);
 
-        // Factor the matrix
-        error = dss_factor_complex(handle, matrixType, values);
-        if (error != MKL_DSS_SUCCESS) return error;
+    // Deallocate solver storage
+    if (error == MKL_DSS_SUCCESS) error = dss_delete(handle, opt);
+    else dss_delete(handle, opt);
 
-        // Get the solution vector
-        error = dss_solve_real(handle, opt, rhsValues, nRhs, solValues);
-        if (error != MKL_DSS_SUCCESS) return error;
+    mkl_free(indices);
+    return (int)error;
+}
 
-        // Deallocate solver storage
-        error = dss_delete(handle, opt);
-        return error;
-    }
+#if __cplusplus
+extern "C" {
+#endif
 
-    DLLEXPORT dss_int z_dss_solve(const dss_int matrixStructure, const dss_int matrixType, const dss_int systemType,
-        const dss_int nRows, const dss_int nCols, const dss_int nnz, const dss_int rowIdx[], const dss_int colPtr[], const dss_complex_double values[],
-        const dss_int nRhs, const dss_complex_double rhsValues[], dss_complex_double solValues[])
+    DLLEXPORT int s_dss_solve(const int matrixStructure, const int matrixType, const int systemType,
+        const int nRows, const int nCols, const int nnz, const int rowIdx[], const int colPtr[], const float values[],
+        const int nRhs, const float rhsValues[], float solValues[])
     {
-        _MKL_DSS_HANDLE_t handle;
-        dss_int error;
-
-        dss_int opt = MKL_DSS_MSG_LVL_WARNING + MKL_DSS_TERM_LVL_ERROR + MKL_DSS_ZERO_BASED_INDEXING + MKL_DSS_AUTO_ORDER;
-        opt += systemType;
-
-        // Initialize the solver
-        error = dss_create(handle, opt);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Define the non-zero structure of the matrix
-        error = dss_define_structure(handle, matrixStructure, rowIdx, nRows, nCols, colPtr, nnz);
-        if (error != MKL_DSS_SUCCESS) return error;
-
-        // Reorder the matrix
-        error = dss_reorder(handle, opt, 0);
-        if (error != MKL_DSS_SUCCESS) return error;
+        return dss_solve_system(0, matrixStructure, matrixType, systemType, nRows, nCols, nnz, rowIdx, colPtr, values, nRhs, rhsValues, solValues);
+    }
 
-        // Factor the matrix
-        error = dss_factor_complex(handle, matrixType, values);
-        if (error != MKL_DSS_SUCCESS) return error;
+    DLLEXPORT int d_dss_solve(const int matrixStructure, const int matrixType, const int systemType,
+        const int nRows, const int nCols, const int nnz, const int rowIdx[], const int colPtr[], const double values[],
+        const int nRhs, const double rhsValues[], double solValues[])
+    {
+        return dss_solve_system(0, matrixStructure, matrixType, systemType, nRows, nCols, nnz, rowIdx, colPtr, values, nRhs, rhsValues, solValues);
+    }
 
-        // Get the solution vector
-        error = dss_solve_real(handle, opt, rhsValues, nRhs, solValues);
-        if (error != MKL_DSS_SUCCESS) return error;
+    DLLEXPORT int c_dss_solve(const int matrixStructure, const int matrixType, const int systemType,
+        const int nRows, const int nCols, const int nnz, const int rowIdx[], const int colPtr[], const dss_complex_float values[],
+        const int nRhs, const dss_complex_float rhsValues[], dss_complex_float solValues[])
+    {
+        return dss_solve_system(1, matrixStructure, matrixType, systemType, nRows, nCols, nnz, rowIdx, colPtr, values, nRhs, rhsValues, solValues);
+    }
 
-        // Deallocate solver storage
-        error = dss_delete(handle, opt);
-        return error;
+    DLLEXPORT int z_dss_solve(const int matrixStructure, const int matrixType, const int systemType,
+        const int nRows, const int nCols, const int nnz, const int rowIdx[], const int colPtr[], const dss_complex_double values[],
+        const int nRhs, const dss_complex_double rhsValues[], dss_complex_double solValues[])
+    {
+        return dss_solve_system(1, matrixStructure, matrixType, systemType, nRows, nCols, nnz, rowIdx, colPtr, values, nRhs, rhsValues, solValues);
     }
 
 #if __cplusplus
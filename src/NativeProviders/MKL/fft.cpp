@@ -4,106 +4,669 @@
 #include <stdlib.h>
 #include <math.h>
 #include <float.h>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
 #include "mkl_dfti.h"
 
 template<typename Precision>
-inline MKL_LONG fft_create_1d(DFTI_DESCRIPTOR_HANDLE* handle, const MKL_LONG n, const Precision forward_scale, const Precision backward_scale, const DFTI_CONFIG_VALUE precision, const DFTI_CONFIG_VALUE domain)
+inline MKL_LONG fft_create_1d(DFTI_DESCRIPTOR_HANDLE* handle, const MKL_LONG n, const Precision forward_scale, const Precision backward_scale, const DFTI_CONFIG_VALUE precision, const DFTI_CONFIG_VALUE domain, const DFTI_CONFIG_VALUE placement)
 {
 	MKL_LONG status = DftiCreateDescriptor(handle, precision, domain, 1, n);
 	DFTI_DESCRIPTOR_HANDLE descriptor = *handle;
 	if (0 == status) status = DftiSetValue(descriptor, DFTI_FORWARD_SCALE, forward_scale);
 	if (0 == status) status = DftiSetValue(descriptor, DFTI_BACKWARD_SCALE, backward_scale);
 	if (0 == status) status = DftiSetValue(descriptor, DFTI_CONJUGATE_EVEN_STORAGE, DFTI_COMPLEX_COMPLEX);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_PLACEMENT, placement);
 	if (0 == status) status = DftiCommitDescriptor(descriptor);
 	return status;
 }
 
 template<typename Precision>
-inline MKL_LONG fft_create_md(DFTI_DESCRIPTOR_HANDLE* handle, MKL_LONG dimensions, MKL_LONG n[], const Precision forward_scale, const Precision backward_scale, const DFTI_CONFIG_VALUE precision, const DFTI_CONFIG_VALUE domain)
+inline MKL_LONG fft_create_md(DFTI_DESCRIPTOR_HANDLE* handle, MKL_LONG dimensions, MKL_LONG n[], const Precision forward_scale, const Precision backward_scale, const DFTI_CONFIG_VALUE precision, const DFTI_CONFIG_VALUE domain, const DFTI_CONFIG_VALUE placement)
 {
 	MKL_LONG status = DftiCreateDescriptor(handle, precision, domain, dimensions, n);
 	DFTI_DESCRIPTOR_HANDLE descriptor = *handle;
 	if (0 == status) status = DftiSetValue(descriptor, DFTI_FORWARD_SCALE, forward_scale);
 	if (0 == status) status = DftiSetValue(descriptor, DFTI_BACKWARD_SCALE, backward_scale);
 	if (0 == status) status = DftiSetValue(descriptor, DFTI_CONJUGATE_EVEN_STORAGE, DFTI_COMPLEX_COMPLEX);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_PLACEMENT, placement);
 	if (0 == status) status = DftiCommitDescriptor(descriptor);
 	return status;
 }
 
+template<typename Precision>
+inline MKL_LONG fft_create_batch(DFTI_DESCRIPTOR_HANDLE* handle, const MKL_LONG n, const MKL_LONG transforms, const MKL_LONG input_distance, const MKL_LONG output_distance, const Precision forward_scale, const Precision backward_scale, const DFTI_CONFIG_VALUE precision, const DFTI_CONFIG_VALUE domain, const DFTI_CONFIG_VALUE placement)
+{
+	MKL_LONG status = DftiCreateDescriptor(handle, precision, domain, 1, n);
+	DFTI_DESCRIPTOR_HANDLE descriptor = *handle;
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_FORWARD_SCALE, forward_scale);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_BACKWARD_SCALE, backward_scale);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_CONJUGATE_EVEN_STORAGE, DFTI_COMPLEX_COMPLEX);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_PLACEMENT, placement);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_NUMBER_OF_TRANSFORMS, transforms);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_INPUT_DISTANCE, input_distance);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_OUTPUT_DISTANCE, output_distance);
+	if (0 == status) status = DftiCommitDescriptor(descriptor);
+	return status;
+}
+
+#define FFT_STORAGE_CCE 0
+#define FFT_STORAGE_CCS 1
+#define FFT_STORAGE_PACK 2
+#define FFT_STORAGE_PERM 3
+
+#define FFT_MAX_DIMENSIONS 7
+
+// Widens the caller's 32-bit lengths for DFTI, which takes them as MKL_LONG (64-bit on Linux and macOS).
+inline bool fft_lengths(const int dimensions, const int n[], MKL_LONG lengths[FFT_MAX_DIMENSIONS])
+{
+	if (dimensions < 1 || dimensions > FFT_MAX_DIMENSIONS) return false;
+	for (int k = 0; k < dimensions; ++k)
+	{
+		lengths[k] = n[k];
+	}
+	return true;
+}
+
+/*
+	Real multidimensional transform. With CCE storage the real and the half spectrum side have different strides,
+	and since a descriptor's input and output strides apply to each compute call, each direction gets its own.
+*/
+struct fft_real_multidim
+{
+	DFTI_DESCRIPTOR_HANDLE forward;
+	DFTI_DESCRIPTOR_HANDLE backward;
+};
+
+// Row-major strides (with the leading zero offset) of an array whose last dimension has length last.
+inline void fft_real_strides(const MKL_LONG dimensions, const MKL_LONG n[], const MKL_LONG last, MKL_LONG strides[])
+{
+	strides[0] = 0;
+	strides[dimensions] = 1;
+	if (dimensions > 1) strides[dimensions - 1] = last;
+	for (MKL_LONG k = dimensions - 2; k >= 1; --k)
+	{
+		strides[k] = strides[k + 1] * n[k];
+	}
+}
+
+template<typename Precision>
+inline MKL_LONG fft_create_real_md(DFTI_DESCRIPTOR_HANDLE* handle, MKL_LONG dimensions, MKL_LONG n[], const Precision forward_scale, const Precision backward_scale, const DFTI_CONFIG_VALUE precision, const int storage, const DFTI_CONFIG_VALUE placement, const bool forward)
+{
+	MKL_LONG status = DftiCreateDescriptor(handle, precision, DFTI_REAL, dimensions, n);
+	DFTI_DESCRIPTOR_HANDLE descriptor = *handle;
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_FORWARD_SCALE, forward_scale);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_BACKWARD_SCALE, backward_scale);
+	if (0 == status) status = DftiSetValue(descriptor, DFTI_PLACEMENT, placement);
+
+	if (storage == FFT_STORAGE_CCE)
+	{
+		const MKL_LONG spectrum = n[dimensions - 1] / 2 + 1;
+		MKL_LONG real_strides[FFT_MAX_DIMENSIONS + 1];
+		MKL_LONG complex_strides[FFT_MAX_DIMENSIONS + 1];
+		fft_real_strides(dimensions, n, placement == DFTI_INPLACE ? 2 * spectrum : n[dimensions - 1], real_strides);
+		fft_real_strides(dimensions, n, spectrum, complex_strides);
+
+		if (0 == status) status = DftiSetValue(descriptor, DFTI_CONJUGATE_EVEN_STORAGE, DFTI_COMPLEX_COMPLEX);
+		if (0 == status) status = DftiSetValue(descriptor, DFTI_INPUT_STRIDES, forward ? real_strides : complex_strides);
+		if (0 == status) status = DftiSetValue(descriptor, DFTI_OUTPUT_STRIDES, forward ? complex_strides : real_strides);
+	}
+	else
+	{
+		const DFTI_CONFIG_VALUE format = storage == FFT_STORAGE_CCS ? DFTI_CCS_FORMAT : storage == FFT_STORAGE_PACK ? DFTI_PACK_FORMAT : DFTI_PERM_FORMAT;
+		if (0 == status) status = DftiSetValue(descriptor, DFTI_CONJUGATE_EVEN_STORAGE, DFTI_COMPLEX_REAL);
+		if (0 == status) status = DftiSetValue(descriptor, DFTI_PACKED_FORMAT, format);
+	}
+
+	if (0 == status) status = DftiCommitDescriptor(descriptor);
+	return status;
+}
+
+template<typename Precision>
+inline MKL_LONG fft_create_real_multidim(fft_real_multidim** handle, MKL_LONG dimensions, MKL_LONG n[], const Precision forward_scale, const Precision backward_scale, const DFTI_CONFIG_VALUE precision, const int storage, const DFTI_CONFIG_VALUE placement)
+{
+	*handle = nullptr;
+	if (dimensions < 1 || dimensions > FFT_MAX_DIMENSIONS || storage < FFT_STORAGE_CCE || storage > FFT_STORAGE_PERM) return DFTI_INVALID_CONFIGURATION;
+
+	fft_real_multidim* transform = static_cast<fft_real_multidim*>(calloc(1, sizeof(fft_real_multidim)));
+	if (!transform) return DFTI_MEMORY_ERROR;
+
+	MKL_LONG status = fft_create_real_md(&transform->forward, dimensions, n, forward_scale, backward_scale, precision, storage, placement, true);
+	if (0 == status) status = fft_create_real_md(&transform->backward, dimensions, n, forward_scale, backward_scale, precision, storage, placement, false);
+	if (0 != status)
+	{
+		if (transform->forward) DftiFreeDescriptor(&transform->forward);
+		if (transform->backward) DftiFreeDescriptor(&transform->backward);
+		free(transform);
+		return status;
+	}
+
+	*handle = transform;
+	return status;
+}
+
+#define FFT_CACHE_DEFAULT_CAPACITY 16
+
+/*
+	Process-wide LRU cache of committed descriptors, so that threads or callers alternating between a few sizes do not
+	create and commit a new descriptor on every transform. A committed descriptor can be used by several threads at once,
+	so each acquire just counts a user; descriptors evicted while still in use are freed by their last release.
+*/
+struct fft_cache_key
+{
+	DFTI_CONFIG_VALUE precision;
+	DFTI_CONFIG_VALUE domain;
+	DFTI_CONFIG_VALUE placement;
+	double forward_scale;
+	double backward_scale;
+	std::vector<MKL_LONG> lengths;
+
+	bool operator<(const fft_cache_key& other) const
+	{
+		return std::tie(precision, domain, placement, forward_scale, backward_scale, lengths)
+			< std::tie(other.precision, other.domain, other.placement, other.forward_scale, other.backward_scale, other.lengths);
+	}
+};
+
+struct fft_cache_entry
+{
+	fft_cache_key key;
+	DFTI_DESCRIPTOR_HANDLE descriptor;
+	int users;
+};
+
+struct fft_cache
+{
+	std::mutex mutex;
+	std::list<fft_cache_entry> entries; // most recently used first
+	std::map<fft_cache_key, std::list<fft_cache_entry>::iterator> index;
+	std::map<DFTI_DESCRIPTOR_HANDLE, int> retired; // evicted but still in use, with their remaining users
+	size_t capacity = FFT_CACHE_DEFAULT_CAPACITY;
+	long long hits = 0;
+	long long misses = 0;
+	long long evictions = 0;
+};
+
+inline fft_cache& fft_cache_instance()
+{
+	static fft_cache cache;
+	return cache;
+}
+
+// Evicts least recently used entries beyond the capacity; collects those no longer in use to be freed outside the lock.
+inline void fft_cache_trim(fft_cache& cache, const size_t capacity, std::vector<DFTI_DESCRIPTOR_HANDLE>& unused)
+{
+	while (cache.entries.size() > capacity)
+	{
+		fft_cache_entry& entry = cache.entries.back();
+		if (entry.users > 0) cache.retired[entry.descriptor] = entry.users;
+		else unused.push_back(entry.descriptor);
+
+		cache.index.erase(entry.key);
+		cache.entries.pop_back();
+		++cache.evictions;
+	}
+}
+
+inline void fft_cache_free(std::vector<DFTI_DESCRIPTOR_HANDLE>& unused)
+{
+	for (DFTI_DESCRIPTOR_HANDLE descriptor : unused)
+	{
+		DftiFreeDescriptor(&descriptor);
+	}
+}
+
+// Moves an entry to the front and counts one more user; the caller holds the lock.
+inline DFTI_DESCRIPTOR_HANDLE fft_cache_use(fft_cache& cache, const std::list<fft_cache_entry>::iterator entry)
+{
+	cache.entries.splice(cache.entries.begin(), cache.entries, entry);
+	++entry->users;
+	return entry->descriptor;
+}
+
+template<typename Precision>
+inline MKL_LONG fft_cache_acquire(DFTI_DESCRIPTOR_HANDLE* handle, MKL_LONG dimensions, MKL_LONG n[], const Precision forward_scale, const Precision backward_scale, const DFTI_CONFIG_VALUE precision, const DFTI_CONFIG_VALUE domain, const DFTI_CONFIG_VALUE placement)
+{
+	*handle = nullptr;
+	if (dimensions < 1 || dimensions > FFT_MAX_DIMENSIONS || (domain == DFTI_REAL && dimensions != 1)) return DFTI_INVALID_CONFIGURATION;
+
+	fft_cache& cache = fft_cache_instance();
+	const fft_cache_key key = { precision, domain, placement, forward_scale, backward_scale, std::vector<MKL_LONG>(n, n + dimensions) };
+
+	{
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		const auto found = cache.index.find(key);
+		if (found != cache.index.end())
+		{
+			++cache.hits;
+			*handle = fft_cache_use(cache, found->second);
+			return 0;
+		}
+
+		++cache.misses;
+	}
+
+	// Committing is expensive, so it happens outside the lock.
+	DFTI_DESCRIPTOR_HANDLE descriptor = nullptr;
+	const MKL_LONG status = dimensions == 1
+		? fft_create_1d(&descriptor, n[0], forward_scale, backward_scale, precision, domain, placement)
+		: fft_create_md(&descriptor, dimensions, n, forward_scale, backward_scale, precision, domain, placement);
+	if (0 != status)
+	{
+		if (descriptor) DftiFreeDescriptor(&descriptor);
+		return status;
+	}
+
+	std::vector<DFTI_DESCRIPTOR_HANDLE> unused;
+	{
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		const auto found = cache.index.find(key);
+		if (found != cache.index.end())
+		{
+			// another thread committed the same descriptor meanwhile
+			*handle = fft_cache_use(cache, found->second);
+			unused.push_back(descriptor);
+		}
+		else
+		{
+			cache.entries.push_front(fft_cache_entry{ key, descriptor, 1 });
+			cache.index[key] = cache.entries.begin();
+			*handle = descriptor;
+			fft_cache_trim(cache, cache.capacity, unused);
+		}
+	}
+
+	fft_cache_free(unused);
+	return 0;
+}
+
 extern "C" {
 
-	DLLEXPORT MKL_LONG x_fft_free(DFTI_DESCRIPTOR_HANDLE* handle)
+	DLLEXPORT int x_fft_free(DFTI_DESCRIPTOR_HANDLE* handle)
 	{
 		return DftiFreeDescriptor(handle);
 	}
 
-	DLLEXPORT MKL_LONG z_fft_create(DFTI_DESCRIPTOR_HANDLE* handle, const MKL_LONG n, const double forward_scale, const double backward_scale)
+	DLLEXPORT int z_fft_create(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const double forward_scale, const double backward_scale)
+	{
+		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_COMPLEX, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int c_fft_create(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const float forward_scale, const float backward_scale)
+	{
+		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_SINGLE, DFTI_COMPLEX, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int d_fft_create(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const double forward_scale, const double backward_scale)
+	{
+		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_REAL, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int s_fft_create(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const float forward_scale, const float backward_scale)
+	{
+		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_SINGLE, DFTI_REAL, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int z_fft_create_multidim(DFTI_DESCRIPTOR_HANDLE* handle, const int dimensions, const int n[], const double forward_scale, const double backward_scale)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_create_md(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_COMPLEX, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int c_fft_create_multidim(DFTI_DESCRIPTOR_HANDLE* handle, const int dimensions, const int n[], const float forward_scale, const float backward_scale)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_create_md(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_SINGLE, DFTI_COMPLEX, DFTI_INPLACE);
+	}
+
+	// Out-of-place descriptors leave the input untouched. Real transforms map n reals to the n/2+1 complex values
+	// of the conjugate-even half spectrum (forward) and back (backward).
+	DLLEXPORT int z_fft_create_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const double forward_scale, const double backward_scale)
+	{
+		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_COMPLEX, DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int c_fft_create_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const float forward_scale, const float backward_scale)
 	{
-		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_COMPLEX);
+		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_SINGLE, DFTI_COMPLEX, DFTI_NOT_INPLACE);
 	}
 
-	DLLEXPORT MKL_LONG c_fft_create(DFTI_DESCRIPTOR_HANDLE* handle, const MKL_LONG n, const float forward_scale, const float backward_scale)
+	DLLEXPORT int d_fft_create_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const double forward_scale, const double backward_scale)
 	{
-		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_SINGLE, DFTI_COMPLEX);
+		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_REAL, DFTI_NOT_INPLACE);
 	}
 
-	DLLEXPORT MKL_LONG d_fft_create(DFTI_DESCRIPTOR_HANDLE* handle, const MKL_LONG n, const double forward_scale, const double backward_scale)
+	DLLEXPORT int s_fft_create_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const float forward_scale, const float backward_scale)
 	{
-		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_REAL);
+		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_SINGLE, DFTI_REAL, DFTI_NOT_INPLACE);
 	}
 
-	DLLEXPORT MKL_LONG s_fft_create(DFTI_DESCRIPTOR_HANDLE* handle, const MKL_LONG n, const float forward_scale, const float backward_scale)
+	DLLEXPORT int z_fft_create_multidim_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int dimensions, const int n[], const double forward_scale, const double backward_scale)
 	{
-		return fft_create_1d(handle, n, forward_scale, backward_scale, DFTI_SINGLE, DFTI_REAL);
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_create_md(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_COMPLEX, DFTI_NOT_INPLACE);
 	}
 
-	DLLEXPORT MKL_LONG z_fft_create_multidim(DFTI_DESCRIPTOR_HANDLE* handle, MKL_LONG dimensions, MKL_LONG n[], const double forward_scale, const double backward_scale)
+	DLLEXPORT int c_fft_create_multidim_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int dimensions, const int n[], const float forward_scale, const float backward_scale)
 	{
-		return fft_create_md(handle, dimensions, n, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_COMPLEX);
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_create_md(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_SINGLE, DFTI_COMPLEX, DFTI_NOT_INPLACE);
 	}
 
-	DLLEXPORT MKL_LONG c_fft_create_multidim(DFTI_DESCRIPTOR_HANDLE* handle, MKL_LONG dimensions, MKL_LONG n[], const float forward_scale, const float backward_scale)
+	// Batched descriptors run `transforms` transforms of length n over consecutive blocks, input_distance and
+	// output_distance elements apart, and work with the regular compute exports. For complex transforms both
+	// distances are at least n. For real transforms they count reals on the real side and complex values on
+	// the half spectrum side (e.g. 2*(n/2+1) and n/2+1 in place, n and n/2+1 out of place); since they apply
+	// to the input and output of each call, the backward direction needs its own descriptor with them swapped.
+	DLLEXPORT int z_fft_create_batch(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const int transforms, const int input_distance, const int output_distance, const double forward_scale, const double backward_scale)
 	{
-		return fft_create_md(handle, dimensions, n, forward_scale, backward_scale, DFTI_SINGLE, DFTI_COMPLEX);
+		return fft_create_batch(handle, n, transforms, input_distance, output_distance, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_COMPLEX, DFTI_INPLACE);
 	}
 
-	DLLEXPORT MKL_LONG z_fft_forward(const DFTI_DESCRIPTOR_HANDLE handle, MKL_Complex16 x[])
+	DLLEXPORT int c_fft_create_batch(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const int transforms, const int input_distance, const int output_distance, const float forward_scale, const float backward_scale)
+	{
+		return fft_create_batch(handle, n, transforms, input_distance, output_distance, forward_scale, backward_scale, DFTI_SINGLE, DFTI_COMPLEX, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int d_fft_create_batch(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const int transforms, const int input_distance, const int output_distance, const double forward_scale, const double backward_scale)
+	{
+		return fft_create_batch(handle, n, transforms, input_distance, output_distance, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_REAL, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int s_fft_create_batch(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const int transforms, const int input_distance, const int output_distance, const float forward_scale, const float backward_scale)
+	{
+		return fft_create_batch(handle, n, transforms, input_distance, output_distance, forward_scale, backward_scale, DFTI_SINGLE, DFTI_REAL, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int z_fft_create_batch_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const int transforms, const int input_distance, const int output_distance, const double forward_scale, const double backward_scale)
+	{
+		return fft_create_batch(handle, n, transforms, input_distance, output_distance, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_COMPLEX, DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int c_fft_create_batch_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const int transforms, const int input_distance, const int output_distance, const float forward_scale, const float backward_scale)
+	{
+		return fft_create_batch(handle, n, transforms, input_distance, output_distance, forward_scale, backward_scale, DFTI_SINGLE, DFTI_COMPLEX, DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int d_fft_create_batch_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const int transforms, const int input_distance, const int output_distance, const double forward_scale, const double backward_scale)
+	{
+		return fft_create_batch(handle, n, transforms, input_distance, output_distance, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_REAL, DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int s_fft_create_batch_outofplace(DFTI_DESCRIPTOR_HANDLE* handle, const int n, const int transforms, const int input_distance, const int output_distance, const float forward_scale, const float backward_scale)
+	{
+		return fft_create_batch(handle, n, transforms, input_distance, output_distance, forward_scale, backward_scale, DFTI_SINGLE, DFTI_REAL, DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int z_fft_forward(const DFTI_DESCRIPTOR_HANDLE handle, MKL_Complex16 x[])
 	{
 		return DftiComputeForward(handle, x);
 	}
 
-	DLLEXPORT MKL_LONG c_fft_forward(const DFTI_DESCRIPTOR_HANDLE handle, MKL_Complex8 x[])
+	DLLEXPORT int c_fft_forward(const DFTI_DESCRIPTOR_HANDLE handle, MKL_Complex8 x[])
 	{
 		return DftiComputeForward(handle, x);
 	}
 
-	DLLEXPORT MKL_LONG d_fft_forward(const DFTI_DESCRIPTOR_HANDLE handle, double x[])
+	DLLEXPORT int d_fft_forward(const DFTI_DESCRIPTOR_HANDLE handle, double x[])
 	{
 		return DftiComputeForward(handle, x);
 	}
 
-	DLLEXPORT MKL_LONG s_fft_forward(const DFTI_DESCRIPTOR_HANDLE handle, float x[])
+	DLLEXPORT int s_fft_forward(const DFTI_DESCRIPTOR_HANDLE handle, float x[])
 	{
 		return DftiComputeForward(handle, x);
 	}
 
-	DLLEXPORT MKL_LONG z_fft_backward(const DFTI_DESCRIPTOR_HANDLE handle, MKL_Complex16 x[])
+	DLLEXPORT int z_fft_backward(const DFTI_DESCRIPTOR_HANDLE handle, MKL_Complex16 x[])
 	{
 		return DftiComputeBackward(handle, x);
 	}
 
-	DLLEXPORT MKL_LONG c_fft_backward(const DFTI_DESCRIPTOR_HANDLE handle, MKL_Complex8 x[])
+	DLLEXPORT int c_fft_backward(const DFTI_DESCRIPTOR_HANDLE handle, MKL_Complex8 x[])
 	{
 		return DftiComputeBackward(handle, x);
 	}
 
-	DLLEXPORT MKL_LONG d_fft_backward(const DFTI_DESCRIPTOR_HANDLE handle, double x[])
+	DLLEXPORT int d_fft_backward(const DFTI_DESCRIPTOR_HANDLE handle, double x[])
 	{
 		return DftiComputeBackward(handle, x);
 	}
 
-	DLLEXPORT MKL_LONG s_fft_backward(const DFTI_DESCRIPTOR_HANDLE handle, float x[])
+	DLLEXPORT int s_fft_backward(const DFTI_DESCRIPTOR_HANDLE handle, float x[])
 	{
 		return DftiComputeBackward(handle, x);
 	}
+
+	DLLEXPORT int z_fft_forward_outofplace(const DFTI_DESCRIPTOR_HANDLE handle, const MKL_Complex16 x[], MKL_Complex16 y[])
+	{
+		return DftiComputeForward(handle, const_cast<MKL_Complex16*>(x), y);
+	}
+
+	DLLEXPORT int c_fft_forward_outofplace(const DFTI_DESCRIPTOR_HANDLE handle, const MKL_Complex8 x[], MKL_Complex8 y[])
+	{
+		return DftiComputeForward(handle, const_cast<MKL_Complex8*>(x), y);
+	}
+
+	DLLEXPORT int d_fft_forward_outofplace(const DFTI_DESCRIPTOR_HANDLE handle, const double x[], MKL_Complex16 y[])
+	{
+		return DftiComputeForward(handle, const_cast<double*>(x), y);
+	}
+
+	DLLEXPORT int s_fft_forward_outofplace(const DFTI_DESCRIPTOR_HANDLE handle, const float x[], MKL_Complex8 y[])
+	{
+		return DftiComputeForward(handle, const_cast<float*>(x), y);
+	}
+
+	DLLEXPORT int z_fft_backward_outofplace(const DFTI_DESCRIPTOR_HANDLE handle, const MKL_Complex16 x[], MKL_Complex16 y[])
+	{
+		return DftiComputeBackward(handle, const_cast<MKL_Complex16*>(x), y);
+	}
+
+	DLLEXPORT int c_fft_backward_outofplace(const DFTI_DESCRIPTOR_HANDLE handle, const MKL_Complex8 x[], MKL_Complex8 y[])
+	{
+		return DftiComputeBackward(handle, const_cast<MKL_Complex8*>(x), y);
+	}
+
+	DLLEXPORT int d_fft_backward_outofplace(const DFTI_DESCRIPTOR_HANDLE handle, const MKL_Complex16 x[], double y[])
+	{
+		return DftiComputeBackward(handle, const_cast<MKL_Complex16*>(x), y);
+	}
+
+	DLLEXPORT int s_fft_backward_outofplace(const DFTI_DESCRIPTOR_HANDLE handle, const MKL_Complex8 x[], float y[])
+	{
+		return DftiComputeBackward(handle, const_cast<MKL_Complex8*>(x), y);
+	}
+
+	// Real multidimensional transforms, row-major. With FFT_STORAGE_CCE the forward transform of an n[0] x ... x n[d-1]
+	// real array is the n[0] x ... x (n[d-1]/2+1) complex half spectrum; in place, the last dimension of the real array
+	// is padded to 2*(n[d-1]/2+1). FFT_STORAGE_CCS, _PACK and _PERM select the packed real formats instead (in place and 2D only).
+
+	DLLEXPORT int x_fft_free_real_multidim(fft_real_multidim* handle)
+	{
+		if (!handle) return 0;
+		MKL_LONG status = DftiFreeDescriptor(&handle->forward);
+		MKL_LONG backward_status = DftiFreeDescriptor(&handle->backward);
+		free(handle);
+		return 0 == status ? backward_status : status;
+	}
+
+	DLLEXPORT int d_fft_create_multidim(fft_real_multidim** handle, const int dimensions, const int n[], const double forward_scale, const double backward_scale, const int storage)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_create_real_multidim(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_DOUBLE, storage, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int s_fft_create_multidim(fft_real_multidim** handle, const int dimensions, const int n[], const float forward_scale, const float backward_scale, const int storage)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_create_real_multidim(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_SINGLE, storage, DFTI_INPLACE);
+	}
+
+	DLLEXPORT int d_fft_create_multidim_outofplace(fft_real_multidim** handle, const int dimensions, const int n[], const double forward_scale, const double backward_scale)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_create_real_multidim(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_DOUBLE, FFT_STORAGE_CCE, DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int s_fft_create_multidim_outofplace(fft_real_multidim** handle, const int dimensions, const int n[], const float forward_scale, const float backward_scale)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_create_real_multidim(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_SINGLE, FFT_STORAGE_CCE, DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int d_fft_real_multidim_forward(const fft_real_multidim* handle, double x[])
+	{
+		return DftiComputeForward(handle->forward, x);
+	}
+
+	DLLEXPORT int s_fft_real_multidim_forward(const fft_real_multidim* handle, float x[])
+	{
+		return DftiComputeForward(handle->forward, x);
+	}
+
+	DLLEXPORT int d_fft_real_multidim_backward(const fft_real_multidim* handle, double x[])
+	{
+		return DftiComputeBackward(handle->backward, x);
+	}
+
+	DLLEXPORT int s_fft_real_multidim_backward(const fft_real_multidim* handle, float x[])
+	{
+		return DftiComputeBackward(handle->backward, x);
+	}
+
+	DLLEXPORT int d_fft_real_multidim_forward_outofplace(const fft_real_multidim* handle, const double x[], MKL_Complex16 y[])
+	{
+		return DftiComputeForward(handle->forward, const_cast<double*>(x), y);
+	}
+
+	DLLEXPORT int s_fft_real_multidim_forward_outofplace(const fft_real_multidim* handle, const float x[], MKL_Complex8 y[])
+	{
+		return DftiComputeForward(handle->forward, const_cast<float*>(x), y);
+	}
+
+	DLLEXPORT int d_fft_real_multidim_backward_outofplace(const fft_real_multidim* handle, const MKL_Complex16 x[], double y[])
+	{
+		return DftiComputeBackward(handle->backward, const_cast<MKL_Complex16*>(x), y);
+	}
+
+	DLLEXPORT int s_fft_real_multidim_backward_outofplace(const fft_real_multidim* handle, const MKL_Complex8 x[], float y[])
+	{
+		return DftiComputeBackward(handle->backward, const_cast<MKL_Complex8*>(x), y);
+	}
+
+	// Descriptor cache. A descriptor from ?_fft_cache_acquire is shared: use it with the regular compute exports and
+	// hand it back with x_fft_cache_release instead of x_fft_free. Real transforms are cached in one dimension only.
+
+	DLLEXPORT int z_fft_cache_acquire(DFTI_DESCRIPTOR_HANDLE* handle, const int dimensions, const int n[], const double forward_scale, const double backward_scale, const int inplace)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_cache_acquire(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_COMPLEX, inplace ? DFTI_INPLACE : DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int c_fft_cache_acquire(DFTI_DESCRIPTOR_HANDLE* handle, const int dimensions, const int n[], const float forward_scale, const float backward_scale, const int inplace)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_cache_acquire(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_SINGLE, DFTI_COMPLEX, inplace ? DFTI_INPLACE : DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int d_fft_cache_acquire(DFTI_DESCRIPTOR_HANDLE* handle, const int dimensions, const int n[], const double forward_scale, const double backward_scale, const int inplace)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_cache_acquire(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_DOUBLE, DFTI_REAL, inplace ? DFTI_INPLACE : DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int s_fft_cache_acquire(DFTI_DESCRIPTOR_HANDLE* handle, const int dimensions, const int n[], const float forward_scale, const float backward_scale, const int inplace)
+	{
+		MKL_LONG lengths[FFT_MAX_DIMENSIONS];
+		*handle = nullptr;
+		if (!fft_lengths(dimensions, n, lengths)) return DFTI_INVALID_CONFIGURATION;
+		return fft_cache_acquire(handle, dimensions, lengths, forward_scale, backward_scale, DFTI_SINGLE, DFTI_REAL, inplace ? DFTI_INPLACE : DFTI_NOT_INPLACE);
+	}
+
+	DLLEXPORT int x_fft_cache_release(DFTI_DESCRIPTOR_HANDLE handle)
+	{
+		fft_cache& cache = fft_cache_instance();
+		{
+			std::lock_guard<std::mutex> lock(cache.mutex);
+			for (fft_cache_entry& entry : cache.entries)
+			{
+				if (entry.descriptor == handle)
+				{
+					// released more often than acquired
+					if (entry.users == 0) return DFTI_BAD_DESCRIPTOR;
+					--entry.users;
+					return 0;
+				}
+			}
+
+			const auto retired = cache.retired.find(handle);
+			if (retired == cache.retired.end()) return DFTI_BAD_DESCRIPTOR;
+			if (--retired->second > 0) return 0;
+			cache.retired.erase(retired);
+		}
+
+		return DftiFreeDescriptor(&handle);
+	}
+
+	// Sets the maximum number of cached descriptors (0 disables caching), evicting the least recently used ones.
+	DLLEXPORT void x_fft_cache_set_capacity(const int capacity)
+	{
+		fft_cache& cache = fft_cache_instance();
+		std::vector<DFTI_DESCRIPTOR_HANDLE> unused;
+		{
+			std::lock_guard<std::mutex> lock(cache.mutex);
+			cache.capacity = capacity > 0 ? static_cast<size_t>(capacity) : 0;
+			fft_cache_trim(cache, cache.capacity, unused);
+		}
+
+		fft_cache_free(unused);
+	}
+
+	DLLEXPORT void x_fft_cache_clear()
+	{
+		fft_cache& cache = fft_cache_instance();
+		std::vector<DFTI_DESCRIPTOR_HANDLE> unused;
+		{
+			std::lock_guard<std::mutex> lock(cache.mutex);
+			fft_cache_trim(cache, 0, unused);
+		}
+
+		fft_cache_free(unused);
+	}
+
+	DLLEXPORT void x_fft_cache_statistics(long long* hits, long long* misses, long long* evictions, int* count)
+	{
+		fft_cache& cache = fft_cache_instance();
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		*hits = cache.hits;
+		*misses = cache.misses;
+		*evictions = cache.evictions;
+		*count = static_cast<int>(cache.entries.size());
+	}
 }
@@ -19,13 +19,13 @@ struct array_free
 template <typename T> using array_ptr = std::unique_ptr<T[], array_free>;
 
 template<typename T>
-inline array_ptr<T> array_new(const int size)
+inline array_ptr<T> array_new(const size_t size)
 {
 	auto ret = static_cast<T*>(mkl_malloc(size * sizeof(T), ALIGNMENT));
 
 	if (!ret)
 	{
-		throw new std::bad_alloc();
+		throw std::bad_alloc();
 	}
 
 	return array_ptr<T>(ret);
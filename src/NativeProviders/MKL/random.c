@@ -0,0 +1,160 @@
+#include "wrapper_common.h"
+#include "random_common.h"
+#include "mkl.h"
+
+/*
+    Notes: random number streams backed by VSL. A stream is created with x_random_create for one of the
+    RANDOM_* generators, filled with any number of ?_random_* calls, and released with x_random_free.
+    To give each worker thread an independent and reproducible stream, create one stream per thread
+    with the same seed (or x_random_copy one) and either skip each ahead by a disjoint block length
+    (x_random_skip_ahead) or split the sequence between the threads (x_random_leapfrog); which of the
+    two a generator supports is up to MKL.
+    Multivariate gaussian vectors are written one after another; cholesky is the lower triangular
+    Cholesky factor of the covariance matrix, column-major.
+    All functions return a VSL status (0 on success).
+*/
+
+// VSL reads a full-storage Cholesky factor as a lower triangle in C (row-major) order, so the column-major
+// factor is handed over as its transpose. Returns NULL if the copy cannot be allocated.
+static float* s_random_cholesky_rows(const int dimension, const float cholesky[])
+{
+    int i, j;
+    float* rows = (float*)mkl_malloc((size_t)dimension * dimension * sizeof(float), 64);
+    if (!rows) return NULL;
+
+    for (i = 0; i < dimension; ++i)
+    {
+        for (j = 0; j < dimension; ++j)
+        {
+            rows[(size_t)i * dimension + j] = cholesky[(size_t)j * dimension + i];
+        }
+    }
+
+    return rows;
+}
+
+static double* d_random_cholesky_rows(const int dimension, const double cholesky[])
+{
+    int i, j;
+    double* rows = (double*)mkl_malloc((size_t)dimension * dimension * sizeof(double), 64);
+    if (!rows) return NULL;
+
+    for (i = 0; i < dimension; ++i)
+    {
+        for (j = 0; j < dimension; ++j)
+        {
+            rows[(size_t)i * dimension + j] = cholesky[(size_t)j * dimension + i];
+        }
+    }
+
+    return rows;
+}
+
+#if __cplusplus
+extern "C" {
+#endif
+
+    DLLEXPORT int x_random_create(VSLStreamStatePtr* stream, const int generator, const int member, const unsigned int seed)
+    {
+        MKL_INT brng;
+        *stream = NULL;
+
+        switch (generator)
+        {
+        case RANDOM_MT19937: brng = VSL_BRNG_MT19937; break;
+        case RANDOM_MT2203: brng = VSL_BRNG_MT2203 + member; break;
+        case RANDOM_PHILOX4X32X10: brng = VSL_BRNG_PHILOX4X32X10; break;
+        case RANDOM_SOBOL: brng = VSL_BRNG_SOBOL; break;
+        default: return VSL_RNG_ERROR_INVALID_BRNG_INDEX;
+        }
+
+        return vslNewStream(stream, brng, seed);
+    }
+
+    DLLEXPORT int x_random_copy(VSLStreamStatePtr* copy, const VSLStreamStatePtr stream)
+    {
+        *copy = NULL;
+        return vslCopyStream(copy, stream);
+    }
+
+    DLLEXPORT int x_random_skip_ahead(VSLStreamStatePtr stream, const long long skip)
+    {
+        return vslSkipAheadStream(stream, skip);
+    }
+
+    DLLEXPORT int x_random_leapfrog(VSLStreamStatePtr stream, const int index, const int streams)
+    {
+        return vslLeapfrogStream(stream, index, streams);
+    }
+
+    DLLEXPORT int x_random_free(VSLStreamStatePtr stream)
+    {
+        return stream ? vslDeleteStream(&stream) : VSL_STATUS_OK;
+    }
+
+    // Uniform on [a, b)
+
+    DLLEXPORT int s_random_uniform(VSLStreamStatePtr stream, const int n, const float a, const float b, float r[])
+    {
+        return vsRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, a, b);
+    }
+
+    DLLEXPORT int d_random_uniform(VSLStreamStatePtr stream, const int n, const double a, const double b, double r[])
+    {
+        return vdRngUniform(VSL_RNG_METHOD_UNIFORM_STD, stream, n, r, a, b);
+    }
+
+    // Inverse CDF transform, which keeps the structure of quasi-random sequences
+
+    DLLEXPORT int s_random_gaussian(VSLStreamStatePtr stream, const int n, const float mean, const float sigma, float r[])
+    {
+        return vsRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r, mean, sigma);
+    }
+
+    DLLEXPORT int d_random_gaussian(VSLStreamStatePtr stream, const int n, const double mean, const double sigma, double r[])
+    {
+        return vdRngGaussian(VSL_RNG_METHOD_GAUSSIAN_ICDF, stream, n, r, mean, sigma);
+    }
+
+    // displacement + exponential with scale beta
+
+    DLLEXPORT int s_random_exponential(VSLStreamStatePtr stream, const int n, const float displacement, const float beta, float r[])
+    {
+        return vsRngExponential(VSL_RNG_METHOD_EXPONENTIAL_ICDF, stream, n, r, displacement, beta);
+    }
+
+    DLLEXPORT int d_random_exponential(VSLStreamStatePtr stream, const int n, const double displacement, const double beta, double r[])
+    {
+        return vdRngExponential(VSL_RNG_METHOD_EXPONENTIAL_ICDF, stream, n, r, displacement, beta);
+    }
+
+    DLLEXPORT int x_random_poisson(VSLStreamStatePtr stream, const int n, const double lambda, int r[])
+    {
+        return viRngPoisson(VSL_RNG_METHOD_POISSON_PTPE, stream, n, r, lambda);
+    }
+
+    DLLEXPORT int s_random_multivariate_gaussian(VSLStreamStatePtr stream, const int n, const int dimension, const float mean[], const float cholesky[], float r[])
+    {
+        int status;
+        float* rows = s_random_cholesky_rows(dimension, cholesky);
+        if (!rows) return VSL_ERROR_MEM_FAILURE;
+
+        status = vsRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_ICDF, stream, n, r, dimension, VSL_MATRIX_STORAGE_FULL, mean, rows);
+        mkl_free(rows);
+        return status;
+    }
+
+    DLLEXPORT int d_random_multivariate_gaussian(VSLStreamStatePtr stream, const int n, const int dimension, const double mean[], const double cholesky[], double r[])
+    {
+        int status;
+        double* rows = d_random_cholesky_rows(dimension, cholesky);
+        if (!rows) return VSL_ERROR_MEM_FAILURE;
+
+        status = vdRngGaussianMV(VSL_RNG_METHOD_GAUSSIANMV_ICDF, stream, n, r, dimension, VSL_MATRIX_STORAGE_FULL, mean, rows);
+        mkl_free(rows);
+        return status;
+    }
+
+#if __cplusplus
+}
+#endif
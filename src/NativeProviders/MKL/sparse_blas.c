@@ -0,0 +1,459 @@
+#include <string.h>
+#include "wrapper_common.h"
+#include "sparse_blas.h"
+#include "mkl.h"
+
+/*
+    Notes: zero-based indexing is used for rowPointers[] and columnIndices[], as in dss.c.
+    All functions return a sparse_status_t (0 on success). A handle is used as follows:
+    ?_sparse_create_csr, then optionally x_sparse_set_mv_hint/x_sparse_set_mm_hint with the expected
+    number of calls followed by x_sparse_optimize, then any number of ?_sparse_mv/?_sparse_mm calls,
+    and finally x_sparse_free.
+
+    Sparse x sparse products returning CSR arrays run in two stages so the caller can allocate exactly once:
+    ?_sparse_multiply_symbolic returns the dimensions and non-zero count of op(A)*op(B),
+    ?_sparse_multiply_numeric fills caller-allocated arrays of that size (column indices sorted per row),
+    and x_sparse_product_free releases the intermediate state. Both operands must stay alive until then.
+*/
+
+static void sparse_handle_free(sparse_handle* handle)
+{
+    if (handle->matrix) mkl_sparse_destroy(handle->matrix);
+    mkl_free(handle->row_pointers);
+    mkl_free(handle->column_indices);
+    mkl_free(handle->values);
+    mkl_free(handle);
+}
+
+static sparse_handle* sparse_handle_new(const sparse_int matrixType, const sparse_int fillMode, const sparse_int diagType,
+    const sparse_int rows, const sparse_int cols, const sparse_int nnz, const int rowPointers[], const int columnIndices[],
+    const void* values, const size_t valueSize)
+{
+    sparse_int i;
+    sparse_handle* handle = (sparse_handle*)mkl_malloc(sizeof(sparse_handle), 64);
+    if (!handle) return NULL;
+
+    handle->matrix = NULL;
+    handle->descr.type = (sparse_matrix_type_t)matrixType;
+    handle->descr.mode = (sparse_fill_mode_t)fillMode;
+    handle->descr.diag = (sparse_diag_type_t)diagType;
+    handle->rows = rows;
+    handle->cols = cols;
+    handle->row_pointers = (sparse_int*)mkl_malloc((rows + 1) * sizeof(sparse_int), 64);
+    handle->column_indices = (sparse_int*)mkl_malloc((nnz > 0 ? nnz : 1) * sizeof(sparse_int), 64);
+    handle->values = mkl_malloc((nnz > 0 ? nnz : 1) * valueSize, 64);
+
+    if (!handle->row_pointers || !handle->column_indices || !handle->values)
+    {
+        sparse_handle_free(handle);
+        return NULL;
+    }
+
+    // The caller's indices are 32-bit; widen them to MKL_INT, which is 64-bit in ILP64 builds.
+    for (i = 0; i <= rows; ++i)
+    {
+        handle->row_pointers[i] = rowPointers[i];
+    }
+
+    for (i = 0; i < nnz; ++i)
+    {
+        handle->column_indices[i] = columnIndices[i];
+    }
+
+    memcpy(handle->values, values, nnz * valueSize);
+    return handle;
+}
+
+static sparse_status_t sparse_handle_created(sparse_handle** handle, sparse_handle* created, const sparse_status_t status)
+{
+    if (status != SPARSE_STATUS_SUCCESS)
+    {
+        sparse_handle_free(created);
+        return status;
+    }
+
+    *handle = created;
+    return status;
+}
+
+static void sparse_product_free(sparse_product* product)
+{
+    if (product->matrix) mkl_sparse_destroy(product->matrix);
+    mkl_free(product);
+}
+
+static sparse_status_t sparse_product_symbolic(sparse_product** product, const sparse_operation_t operationA, const sparse_handle* a,
+    const sparse_operation_t operationB, const sparse_handle* b)
+{
+    sparse_status_t status;
+    sparse_product* created = (sparse_product*)mkl_malloc(sizeof(sparse_product), 64);
+    *product = NULL;
+    if (!created) return SPARSE_STATUS_ALLOC_FAILED;
+
+    created->matrix = NULL;
+    created->operationA = operationA;
+    created->operationB = operationB;
+    created->a = a;
+    created->b = b;
+
+    status = mkl_sparse_sp2m(operationA, a->descr, a->matrix, operationB, b->descr, b->matrix, SPARSE_STAGE_NNZ_COUNT, &created->matrix);
+    if (status != SPARSE_STATUS_SUCCESS)
+    {
+        sparse_product_free(created);
+        return status;
+    }
+
+    *product = created;
+    return status;
+}
+
+static sparse_status_t sparse_product_finalize(sparse_product* product)
+{
+    const sparse_status_t status = mkl_sparse_sp2m(product->operationA, product->a->descr, product->a->matrix,
+        product->operationB, product->b->descr, product->b->matrix, SPARSE_STAGE_FINALIZE_MULT, &product->matrix);
+    if (status != SPARSE_STATUS_SUCCESS) return status;
+
+    return mkl_sparse_order(product->matrix);
+}
+
+// Copies an exported zero-based CSR structure into caller arrays of rows+1 pointers and nnz entries, narrowing the indices to int.
+static void sparse_export_copy(const sparse_int rows, const sparse_int* rowsStart, const sparse_int* rowsEnd, const sparse_int* columns,
+    const void* values, const size_t valueSize, int rowPointers[], int columnIndices[], void* target)
+{
+    const sparse_int first = rows > 0 ? rowsStart[0] : 0;
+    const sparse_int nnz = rows > 0 ? rowsEnd[rows - 1] - first : 0;
+    sparse_int i;
+
+    for (i = 0; i < rows; ++i)
+    {
+        rowPointers[i] = (int)(rowsStart[i] - first);
+    }
+
+    rowPointers[rows] = (int)nnz;
+    for (i = 0; i < nnz; ++i)
+    {
+        columnIndices[i] = (int)columns[first + i];
+    }
+
+    memcpy(target, (const char*)values + first * valueSize, nnz * valueSize);
+}
+
+static sparse_int sparse_export_nnz(const sparse_int rows, const sparse_int* rowsStart, const sparse_int* rowsEnd)
+{
+    return rows > 0 ? rowsEnd[rows - 1] - rowsStart[0] : 0;
+}
+
+#if __cplusplus
+extern "C" {
+#endif
+
+    DLLEXPORT sparse_status_t s_sparse_create_csr(sparse_handle** handle, const int matrixType, const int fillMode, const int diagType,
+        const int rows, const int cols, const int nnz, const int rowPointers[], const int columnIndices[], const float values[])
+    {
+        sparse_handle* created = sparse_handle_new(matrixType, fillMode, diagType, rows, cols, nnz, rowPointers, columnIndices, values, sizeof(float));
+        *handle = NULL;
+        if (!created) return SPARSE_STATUS_ALLOC_FAILED;
+
+        return sparse_handle_created(handle, created, mkl_sparse_s_create_csr(&created->matrix, SPARSE_INDEX_BASE_ZERO, rows, cols,
+            created->row_pointers, created->row_pointers + 1, created->column_indices, (float*)created->values));
+    }
+
+    DLLEXPORT sparse_status_t d_sparse_create_csr(sparse_handle** handle, const int matrixType, const int fillMode, const int diagType,
+        const int rows, const int cols, const int nnz, const int rowPointers[], const int columnIndices[], const double values[])
+    {
+        sparse_handle* created = sparse_handle_new(matrixType, fillMode, diagType, rows, cols, nnz, rowPointers, columnIndices, values, sizeof(double));
+        *handle = NULL;
+        if (!created) return SPARSE_STATUS_ALLOC_FAILED;
+
+        return sparse_handle_created(handle, created, mkl_sparse_d_create_csr(&created->matrix, SPARSE_INDEX_BASE_ZERO, rows, cols,
+            created->row_pointers, created->row_pointers + 1, created->column_indices, (double*)created->values));
+    }
+
+    DLLEXPORT sparse_status_t c_sparse_create_csr(sparse_handle** handle, const int matrixType, const int fillMode, const int diagType,
+        const int rows, const int cols, const int nnz, const int rowPointers[], const int columnIndices[], const sparse_complex_float values[])
+    {
+        sparse_handle* created = sparse_handle_new(matrixType, fillMode, diagType, rows, cols, nnz, rowPointers, columnIndices, values, sizeof(sparse_complex_float));
+        *handle = NULL;
+        if (!created) return SPARSE_STATUS_ALLOC_FAILED;
+
+        return sparse_handle_created(handle, created, mkl_sparse_c_create_csr(&created->matrix, SPARSE_INDEX_BASE_ZERO, rows, cols,
+            created->row_pointers, created->row_pointers + 1, created->column_indices, (sparse_complex_float*)created->values));
+    }
+
+    DLLEXPORT sparse_status_t z_sparse_create_csr(sparse_handle** handle, const int matrixType, const int fillMode, const int diagType,
+        const int rows, const int cols, const int nnz, const int rowPointers[], const int columnIndices[], const sparse_complex_double values[])
+    {
+        sparse_handle* created = sparse_handle_new(matrixType, fillMode, diagType, rows, cols, nnz, rowPointers, columnIndices, values, sizeof(sparse_complex_double));
+        *handle = NULL;
+        if (!created) return SPARSE_STATUS_ALLOC_FAILED;
+
+        return sparse_handle_created(handle, created, mkl_sparse_z_create_csr(&created->matrix, SPARSE_INDEX_BASE_ZERO, rows, cols,
+            created->row_pointers, created->row_pointers + 1, created->column_indices, (sparse_complex_double*)created->values));
+    }
+
+    DLLEXPORT sparse_status_t x_sparse_set_mv_hint(sparse_handle* handle, const sparse_operation_t operation, const int expectedCalls)
+    {
+        return mkl_sparse_set_mv_hint(handle->matrix, operation, handle->descr, expectedCalls);
+    }
+
+    DLLEXPORT sparse_status_t x_sparse_set_mm_hint(sparse_handle* handle, const sparse_operation_t operation, const int columns, const int expectedCalls)
+    {
+        return mkl_sparse_set_mm_hint(handle->matrix, operation, handle->descr, SPARSE_LAYOUT_COLUMN_MAJOR, columns, expectedCalls);
+    }
+
+    DLLEXPORT sparse_status_t x_sparse_optimize(sparse_handle* handle)
+    {
+        return mkl_sparse_optimize(handle->matrix);
+    }
+
+    DLLEXPORT void x_sparse_free(sparse_handle* handle)
+    {
+        if (handle) sparse_handle_free(handle);
+    }
+
+    // y = alpha*op(A)*x + beta*y
+
+    DLLEXPORT sparse_status_t s_sparse_mv(const sparse_handle* handle, const sparse_operation_t operation, const float alpha, const float x[], const float beta, float y[])
+    {
+        return mkl_sparse_s_mv(operation, alpha, handle->matrix, handle->descr, x, beta, y);
+    }
+
+    DLLEXPORT sparse_status_t d_sparse_mv(const sparse_handle* handle, const sparse_operation_t operation, const double alpha, const double x[], const double beta, double y[])
+    {
+        return mkl_sparse_d_mv(operation, alpha, handle->matrix, handle->descr, x, beta, y);
+    }
+
+    DLLEXPORT sparse_status_t c_sparse_mv(const sparse_handle* handle, const sparse_operation_t operation, const sparse_complex_float alpha, const sparse_complex_float x[], const sparse_complex_float beta, sparse_complex_float y[])
+    {
+        return mkl_sparse_c_mv(operation, alpha, handle->matrix, handle->descr, x, beta, y);
+    }
+
+    DLLEXPORT sparse_status_t z_sparse_mv(const sparse_handle* handle, const sparse_operation_t operation, const sparse_complex_double alpha, const sparse_complex_double x[], const sparse_complex_double beta, sparse_complex_double y[])
+    {
+        return mkl_sparse_z_mv(operation, alpha, handle->matrix, handle->descr, x, beta, y);
+    }
+
+    // Y = alpha*op(A)*X + beta*Y with X and Y dense column-major with the given number of columns
+
+    DLLEXPORT sparse_status_t s_sparse_mm(const sparse_handle* handle, const sparse_operation_t operation, const float alpha, const int columns, const float x[], const float beta, float y[])
+    {
+        const sparse_int ldx = operation == SPARSE_OPERATION_NON_TRANSPOSE ? handle->cols : handle->rows;
+        const sparse_int ldy = operation == SPARSE_OPERATION_NON_TRANSPOSE ? handle->rows : handle->cols;
+        return mkl_sparse_s_mm(operation, alpha, handle->matrix, handle->descr, SPARSE_LAYOUT_COLUMN_MAJOR, x, columns, ldx, beta, y, ldy);
+    }
+
+    DLLEXPORT sparse_status_t d_sparse_mm(const sparse_handle* handle, const sparse_operation_t operation, const double alpha, const int columns, const double x[], const double beta, double y[])
+    {
+        const sparse_int ldx = operation == SPARSE_OPERATION_NON_TRANSPOSE ? handle->cols : handle->rows;
+        const sparse_int ldy = operation == SPARSE_OPERATION_NON_TRANSPOSE ? handle->rows : handle->cols;
+        return mkl_sparse_d_mm(operation, alpha, handle->matrix, handle->descr, SPARSE_LAYOUT_COLUMN_MAJOR, x, columns, ldx, beta, y, ldy);
+    }
+
+    DLLEXPORT sparse_status_t c_sparse_mm(const sparse_handle* handle, const sparse_operation_t operation, const sparse_complex_float alpha, const int columns, const sparse_complex_float x[], const sparse_complex_float beta, sparse_complex_float y[])
+    {
+        const sparse_int ldx = operation == SPARSE_OPERATION_NON_TRANSPOSE ? handle->cols : handle->rows;
+        const sparse_int ldy = operation == SPARSE_OPERATION_NON_TRANSPOSE ? handle->rows : handle->cols;
+        return mkl_sparse_c_mm(operation, alpha, handle->matrix, handle->descr, SPARSE_LAYOUT_COLUMN_MAJOR, x, columns, ldx, beta, y, ldy);
+    }
+
+    DLLEXPORT sparse_status_t z_sparse_mm(const sparse_handle* handle, const sparse_operation_t operation, const sparse_complex_double alpha, const int columns, const sparse_complex_double x[], const sparse_complex_double beta, sparse_complex_double y[])
+    {
+        const sparse_int ldx = operation == SPARSE_OPERATION_NON_TRANSPOSE ? handle->cols : handle->rows;
+        const sparse_int ldy = operation == SPARSE_OPERATION_NON_TRANSPOSE ? handle->rows : handle->cols;
+        return mkl_sparse_z_mm(operation, alpha, handle->matrix, handle->descr, SPARSE_LAYOUT_COLUMN_MAJOR, x, columns, ldx, beta, y, ldy);
+    }
+
+    DLLEXPORT sparse_status_t s_sparse_multiply_symbolic(sparse_product** product, const sparse_operation_t operationA, const sparse_handle* a,
+        const sparse_operation_t operationB, const sparse_handle* b, int* rows, int* cols, int* nnz)
+    {
+        sparse_index_base_t indexing;
+        sparse_int exportedRows, exportedCols;
+        sparse_int *rowsStart, *rowsEnd, *columns;
+        float* values;
+        sparse_status_t status = sparse_product_symbolic(product, operationA, a, operationB, b);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        status = mkl_sparse_s_export_csr((*product)->matrix, &indexing, &exportedRows, &exportedCols, &rowsStart, &rowsEnd, &columns, &values);
+        if (status != SPARSE_STATUS_SUCCESS)
+        {
+            sparse_product_free(*product);
+            *product = NULL;
+            return status;
+        }
+
+        *rows = (int)exportedRows;
+        *cols = (int)exportedCols;
+        *nnz = (int)sparse_export_nnz(exportedRows, rowsStart, rowsEnd);
+        return status;
+    }
+
+    DLLEXPORT sparse_status_t d_sparse_multiply_symbolic(sparse_product** product, const sparse_operation_t operationA, const sparse_handle* a,
+        const sparse_operation_t operationB, const sparse_handle* b, int* rows, int* cols, int* nnz)
+    {
+        sparse_index_base_t indexing;
+        sparse_int exportedRows, exportedCols;
+        sparse_int *rowsStart, *rowsEnd, *columns;
+        double* values;
+        sparse_status_t status = sparse_product_symbolic(product, operationA, a, operationB, b);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        status = mkl_sparse_d_export_csr((*product)->matrix, &indexing, &exportedRows, &exportedCols, &rowsStart, &rowsEnd, &columns, &values);
+        if (status != SPARSE_STATUS_SUCCESS)
+        {
+            sparse_product_free(*product);
+            *product = NULL;
+            return status;
+        }
+
+        *rows = (int)exportedRows;
+        *cols = (int)exportedCols;
+        *nnz = (int)sparse_export_nnz(exportedRows, rowsStart, rowsEnd);
+        return status;
+    }
+
+    DLLEXPORT sparse_status_t c_sparse_multiply_symbolic(sparse_product** product, const sparse_operation_t operationA, const sparse_handle* a,
+        const sparse_operation_t operationB, const sparse_handle* b, int* rows, int* cols, int* nnz)
+    {
+        sparse_index_base_t indexing;
+        sparse_int exportedRows, exportedCols;
+        sparse_int *rowsStart, *rowsEnd, *columns;
+        sparse_complex_float* values;
+        sparse_status_t status = sparse_product_symbolic(product, operationA, a, operationB, b);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        status = mkl_sparse_c_export_csr((*product)->matrix, &indexing, &exportedRows, &exportedCols, &rowsStart, &rowsEnd, &columns, &values);
+        if (status != SPARSE_STATUS_SUCCESS)
+        {
+            sparse_product_free(*product);
+            *product = NULL;
+            return status;
+        }
+
+        *rows = (int)exportedRows;
+        *cols = (int)exportedCols;
+        *nnz = (int)sparse_export_nnz(exportedRows, rowsStart, rowsEnd);
+        return status;
+    }
+
+    DLLEXPORT sparse_status_t z_sparse_multiply_symbolic(sparse_product** product, const sparse_operation_t operationA, const sparse_handle* a,
+        const sparse_operation_t operationB, const sparse_handle* b, int* rows, int* cols, int* nnz)
+    {
+        sparse_index_base_t indexing;
+        sparse_int exportedRows, exportedCols;
+        sparse_int *rowsStart, *rowsEnd, *columns;
+        sparse_complex_double* values;
+        sparse_status_t status = sparse_product_symbolic(product, operationA, a, operationB, b);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        status = mkl_sparse_z_export_csr((*product)->matrix, &indexing, &exportedRows, &exportedCols, &rowsStart, &rowsEnd, &columns, &values);
+        if (status != SPARSE_STATUS_SUCCESS)
+        {
+            sparse_product_free(*product);
+            *product = NULL;
+            return status;
+        }
+
+        *rows = (int)exportedRows;
+        *cols = (int)exportedCols;
+        *nnz = (int)sparse_export_nnz(exportedRows, rowsStart, rowsEnd);
+        return status;
+    }
+
+    DLLEXPORT sparse_status_t s_sparse_multiply_numeric(sparse_product* product, int rowPointers[], int columnIndices[], float values[])
+    {
+        sparse_index_base_t indexing;
+        sparse_int rows, cols;
+        sparse_int *rowsStart, *rowsEnd, *columns;
+        float* exported;
+        sparse_status_t status = sparse_product_finalize(product);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        status = mkl_sparse_s_export_csr(product->matrix, &indexing, &rows, &cols, &rowsStart, &rowsEnd, &columns, &exported);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        sparse_export_copy(rows, rowsStart, rowsEnd, columns, exported, sizeof(float), rowPointers, columnIndices, values);
+        return status;
+    }
+
+    DLLEXPORT sparse_status_t d_sparse_multiply_numeric(sparse_product* product, int rowPointers[], int columnIndices[], double values[])
+    {
+        sparse_index_base_t indexing;
+        sparse_int rows, cols;
+        sparse_int *rowsStart, *rowsEnd, *columns;
+        double* exported;
+        sparse_status_t status = sparse_product_finalize(product);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        status = mkl_sparse_d_export_csr(product->matrix, &indexing, &rows, &cols, &rowsStart, &rowsEnd, &columns, &exported);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        sparse_export_copy(rows, rowsStart, rowsEnd, columns, exported, sizeof(double), rowPointers, columnIndices, values);
+        return status;
+    }
+
+    DLLEXPORT sparse_status_t c_sparse_multiply_numeric(sparse_product* product, int rowPointers[], int columnIndices[], sparse_complex_float values[])
+    {
+        sparse_index_base_t indexing;
+        sparse_int rows, cols;
+        sparse_int *rowsStart, *rowsEnd, *columns;
+        sparse_complex_float* exported;
+        sparse_status_t status = sparse_product_finalize(product);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        status = mkl_sparse_c_export_csr(product->matrix, &indexing, &rows, &cols, &rowsStart, &rowsEnd, &columns, &exported);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        sparse_export_copy(rows, rowsStart, rowsEnd, columns, exported, sizeof(sparse_complex_float), rowPointers, columnIndices, values);
+        return status;
+    }
+
+    DLLEXPORT sparse_status_t z_sparse_multiply_numeric(sparse_product* product, int rowPointers[], int columnIndices[], sparse_complex_double values[])
+    {
+        sparse_index_base_t indexing;
+        sparse_int rows, cols;
+        sparse_int *rowsStart, *rowsEnd, *columns;
+        sparse_complex_double* exported;
+        sparse_status_t status = sparse_product_finalize(product);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        status = mkl_sparse_z_export_csr(product->matrix, &indexing, &rows, &cols, &rowsStart, &rowsEnd, &columns, &exported);
+        if (status != SPARSE_STATUS_SUCCESS) return status;
+
+        sparse_export_copy(rows, rowsStart, rowsEnd, columns, exported, sizeof(sparse_complex_double), rowPointers, columnIndices, values);
+        return status;
+    }
+
+    DLLEXPORT void x_sparse_product_free(sparse_product* product)
+    {
+        if (product) sparse_product_free(product);
+    }
+
+    // C = op(A)*B with both operands sparse and C dense column-major
+
+    DLLEXPORT sparse_status_t s_sparse_multiply_dense(const sparse_operation_t operationA, const sparse_handle* a, const sparse_handle* b, float c[])
+    {
+        const sparse_int ldc = operationA == SPARSE_OPERATION_NON_TRANSPOSE ? a->rows : a->cols;
+        return mkl_sparse_s_spmmd(operationA, a->matrix, b->matrix, SPARSE_LAYOUT_COLUMN_MAJOR, c, ldc);
+    }
+
+    DLLEXPORT sparse_status_t d_sparse_multiply_dense(const sparse_operation_t operationA, const sparse_handle* a, const sparse_handle* b, double c[])
+    {
+        const sparse_int ldc = operationA == SPARSE_OPERATION_NON_TRANSPOSE ? a->rows : a->cols;
+        return mkl_sparse_d_spmmd(operationA, a->matrix, b->matrix, SPARSE_LAYOUT_COLUMN_MAJOR, c, ldc);
+    }
+
+    DLLEXPORT sparse_status_t c_sparse_multiply_dense(const sparse_operation_t operationA, const sparse_handle* a, const sparse_handle* b, sparse_complex_float c[])
+    {
+        const sparse_int ldc = operationA == SPARSE_OPERATION_NON_TRANSPOSE ? a->rows : a->cols;
+        return mkl_sparse_c_spmmd(operationA, a->matrix, b->matrix, SPARSE_LAYOUT_COLUMN_MAJOR, c, ldc);
+    }
+
+    DLLEXPORT sparse_status_t z_sparse_multiply_dense(const sparse_operation_t operationA, const sparse_handle* a, const sparse_handle* b, sparse_complex_double c[])
+    {
+        const sparse_int ldc = operationA == SPARSE_OPERATION_NON_TRANSPOSE ? a->rows : a->cols;
+        return mkl_sparse_z_spmmd(operationA, a->matrix, b->matrix, SPARSE_LAYOUT_COLUMN_MAJOR, c, ldc);
+    }
+
+#if __cplusplus
+}
+#endif
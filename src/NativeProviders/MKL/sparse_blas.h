@@ -0,0 +1,37 @@
+#pragma once
+
+#include "mkl_spblas.h"
+#include "mkl_types.h"
+
+#define sparse_int             MKL_INT
+#define sparse_complex_float   MKL_Complex8
+#define sparse_complex_double  MKL_Complex16
+
+/*
+    A CSR matrix registered with the MKL inspector-executor sparse BLAS.
+    The CSR arrays are owned copies, since MKL keeps referring to them for the lifetime
+    of the matrix while the managed arrays they came from may move or be collected.
+*/
+typedef struct
+{
+    sparse_matrix_t matrix;
+    struct matrix_descr descr;
+    sparse_int rows;
+    sparse_int cols;
+    sparse_int* row_pointers;
+    sparse_int* column_indices;
+    void* values;
+} sparse_handle;
+
+/*
+    A sparse x sparse product between its symbolic stage (non-zero count) and its numeric stage.
+    Keeps the operands so the numeric stage can be run once the caller has allocated the result arrays.
+*/
+typedef struct
+{
+    sparse_matrix_t matrix;
+    sparse_operation_t operationA;
+    sparse_operation_t operationB;
+    const sparse_handle* a;
+    const sparse_handle* b;
+} sparse_product;
@@ -0,0 +1,391 @@
+#include <math.h>
+#include <string.h>
+#include "wrapper_common.h"
+#include "summary_statistics.h"
+#include "mkl.h"
+
+/*
+    Notes: a handle accumulates summary statistics over observations fed in blocks, without keeping them.
+    ?_summary_statistics_create selects the estimates (a combination of the VSL_SS_MEAN, VSL_SS_2C_MOM,
+    VSL_SS_3C_MOM, VSL_SS_4C_MOM, VSL_SS_SKEWNESS, VSL_SS_KURTOSIS, VSL_SS_COV, VSL_SS_MIN, VSL_SS_MAX and
+    VSL_SS_STREAM_QUANTS flags); each ?_summary_statistics_update then folds in one block of observations,
+    and ?_summary_statistics_get copies out the running value of one estimate. Finally x_summary_statistics_free.
+
+    A block of n observations of a dimension p random vector is a column-major n x p matrix (one observation
+    per row, each variable contiguous), or a p x n matrix if observationsInColumns is set.
+    The covariance is a full p x p matrix; streaming quantile k of variable i is at result[i * orders + k].
+    All functions return a VSL status (0 on success).
+*/
+
+// Estimates that must be computed alongside the requested ones in progressive mode.
+static stats_estimates stats_expand_estimates(stats_estimates estimates)
+{
+    if (estimates & VSL_SS_KURTOSIS) estimates |= VSL_SS_4C_MOM | VSL_SS_2C_MOM;
+    if (estimates & VSL_SS_SKEWNESS) estimates |= VSL_SS_3C_MOM | VSL_SS_2C_MOM;
+    if (estimates & VSL_SS_4C_MOM) estimates |= VSL_SS_4R_MOM | VSL_SS_3R_MOM | VSL_SS_2R_MOM;
+    if (estimates & VSL_SS_3C_MOM) estimates |= VSL_SS_3R_MOM | VSL_SS_2R_MOM;
+    if (estimates & VSL_SS_2C_MOM) estimates |= VSL_SS_2R_MOM;
+    if (estimates & (VSL_SS_2R_MOM | VSL_SS_3R_MOM | VSL_SS_4R_MOM | VSL_SS_COV)) estimates |= VSL_SS_MEAN;
+    return estimates;
+}
+
+static const stats_estimates STATS_MOMENTS = VSL_SS_MEAN | VSL_SS_2R_MOM | VSL_SS_3R_MOM | VSL_SS_4R_MOM
+    | VSL_SS_2C_MOM | VSL_SS_3C_MOM | VSL_SS_4C_MOM | VSL_SS_SKEWNESS | VSL_SS_KURTOSIS | VSL_SS_COV;
+static const stats_estimates STATS_EXTREMES = VSL_SS_MIN | VSL_SS_MAX;
+
+static void* stats_array(const summary_statistics* stats, const stats_estimates estimate, const size_t count)
+{
+    return (stats->estimates & estimate) ? mkl_calloc(count, stats->value_size, 64) : NULL;
+}
+
+static void summary_statistics_free(summary_statistics* stats)
+{
+    if (stats->task) vslSSDeleteTask(&stats->task);
+    mkl_free(stats->weights);
+    mkl_free(stats->mean);
+    mkl_free(stats->raw2);
+    mkl_free(stats->raw3);
+    mkl_free(stats->raw4);
+    mkl_free(stats->central2);
+    mkl_free(stats->central3);
+    mkl_free(stats->central4);
+    mkl_free(stats->skewness);
+    mkl_free(stats->kurtosis);
+    mkl_free(stats->covariance);
+    mkl_free(stats->min);
+    mkl_free(stats->max);
+    mkl_free(stats->quantile_orders);
+    mkl_free(stats->quantiles);
+    mkl_free(stats->quantile_parameters);
+    mkl_free(stats);
+}
+
+static summary_statistics* summary_statistics_new(const stats_int dimension, const int observationsInColumns, const stats_estimates estimates,
+    const stats_int quantileCount, const size_t valueSize)
+{
+    const size_t p = (size_t)dimension;
+    summary_statistics* stats = (summary_statistics*)mkl_calloc(1, sizeof(summary_statistics), 64);
+    if (!stats) return NULL;
+
+    stats->dimension = dimension;
+    stats->storage = observationsInColumns ? VSL_SS_MATRIX_STORAGE_COLS : VSL_SS_MATRIX_STORAGE_ROWS;
+    stats->covariance_storage = VSL_SS_MATRIX_STORAGE_FULL;
+    stats->quantile_count = quantileCount;
+    stats->quantile_parameter_count = 1;
+    stats->estimates = stats_expand_estimates(estimates);
+    stats->value_size = valueSize;
+
+    stats->weights = mkl_malloc(2 * valueSize, 64);
+    stats->mean = stats_array(stats, VSL_SS_MEAN, p);
+    stats->raw2 = stats_array(stats, VSL_SS_2R_MOM, p);
+    stats->raw3 = stats_array(stats, VSL_SS_3R_MOM, p);
+    stats->raw4 = stats_array(stats, VSL_SS_4R_MOM, p);
+    stats->central2 = stats_array(stats, VSL_SS_2C_MOM, p);
+    stats->central3 = stats_array(stats, VSL_SS_3C_MOM, p);
+    stats->central4 = stats_array(stats, VSL_SS_4C_MOM, p);
+    stats->skewness = stats_array(stats, VSL_SS_SKEWNESS, p);
+    stats->kurtosis = stats_array(stats, VSL_SS_KURTOSIS, p);
+    stats->covariance = stats_array(stats, VSL_SS_COV, p * p);
+    stats->min = stats_array(stats, VSL_SS_MIN, p);
+    stats->max = stats_array(stats, VSL_SS_MAX, p);
+    stats->quantile_orders = stats_array(stats, VSL_SS_STREAM_QUANTS, (size_t)quantileCount);
+    stats->quantiles = stats_array(stats, VSL_SS_STREAM_QUANTS, p * quantileCount);
+    stats->quantile_parameters = stats_array(stats, VSL_SS_STREAM_QUANTS, 1);
+
+    if (!stats->weights
+        || ((stats->estimates & VSL_SS_MEAN) && !stats->mean)
+        || ((stats->estimates & VSL_SS_2R_MOM) && !stats->raw2)
+        || ((stats->estimates & VSL_SS_3R_MOM) && !stats->raw3)
+        || ((stats->estimates & VSL_SS_4R_MOM) && !stats->raw4)
+        || ((stats->estimates & VSL_SS_2C_MOM) && !stats->central2)
+        || ((stats->estimates & VSL_SS_3C_MOM) && !stats->central3)
+        || ((stats->estimates & VSL_SS_4C_MOM) && !stats->central4)
+        || ((stats->estimates & VSL_SS_SKEWNESS) && !stats->skewness)
+        || ((stats->estimates & VSL_SS_KURTOSIS) && !stats->kurtosis)
+        || ((stats->estimates & VSL_SS_COV) && !stats->covariance)
+        || ((stats->estimates & VSL_SS_MIN) && !stats->min)
+        || ((stats->estimates & VSL_SS_MAX) && !stats->max)
+        || ((stats->estimates & VSL_SS_STREAM_QUANTS) && !(stats->quantile_orders && stats->quantiles && stats->quantile_parameters)))
+    {
+        summary_statistics_free(stats);
+        return NULL;
+    }
+
+    return stats;
+}
+
+// The result array of a single estimate flag and its length, NULL if it was not requested.
+static const void* stats_estimate_array(const summary_statistics* stats, const stats_estimates estimate, size_t* count)
+{
+    const size_t p = (size_t)stats->dimension;
+    *count = p;
+
+    switch (estimate)
+    {
+    case VSL_SS_MEAN: return stats->mean;
+    case VSL_SS_2R_MOM: return stats->raw2;
+    case VSL_SS_3R_MOM: return stats->raw3;
+    case VSL_SS_4R_MOM: return stats->raw4;
+    case VSL_SS_2C_MOM: return stats->central2;
+    case VSL_SS_3C_MOM: return stats->central3;
+    case VSL_SS_4C_MOM: return stats->central4;
+    case VSL_SS_SKEWNESS: return stats->skewness;
+    case VSL_SS_KURTOSIS: return stats->kurtosis;
+    case VSL_SS_MIN: return stats->min;
+    case VSL_SS_MAX: return stats->max;
+    case VSL_SS_COV:
+        *count = p * p;
+        return stats->covariance;
+    case VSL_SS_STREAM_QUANTS:
+        *count = p * stats->quantile_count;
+        return stats->quantiles;
+    default: return NULL;
+    }
+}
+
+static void s_stats_initialize(summary_statistics* stats, const float orders[], const float epsilon)
+{
+    const size_t p = (size_t)stats->dimension;
+    size_t i;
+
+    ((float*)stats->weights)[0] = 0.0f;
+    ((float*)stats->weights)[1] = 0.0f;
+
+    for (i = 0; i < p; ++i)
+    {
+        if (stats->min) ((float*)stats->min)[i] = HUGE_VALF;
+        if (stats->max) ((float*)stats->max)[i] = -HUGE_VALF;
+    }
+
+    if (stats->estimates & VSL_SS_STREAM_QUANTS)
+    {
+        memcpy(stats->quantile_orders, orders, stats->quantile_count * sizeof(float));
+        ((float*)stats->quantile_parameters)[0] = epsilon;
+    }
+}
+
+static int s_stats_register(summary_statistics* stats, const float x[])
+{
+    int status = vslsSSNewTask(&stats->task, &stats->dimension, &stats->observations, &stats->storage, x, NULL, NULL);
+    if (status != VSL_STATUS_OK) return status;
+
+    status = vslsSSEditTask(stats->task, VSL_SS_ED_ACCUM_WEIGHT, (float*)stats->weights);
+    if (status == VSL_STATUS_OK && (stats->estimates & STATS_MOMENTS))
+    {
+        status = vslsSSEditMoments(stats->task, (float*)stats->mean, (float*)stats->raw2, (float*)stats->raw3, (float*)stats->raw4,
+            (float*)stats->central2, (float*)stats->central3, (float*)stats->central4);
+    }
+    if (status == VSL_STATUS_OK && stats->skewness) status = vslsSSEditTask(stats->task, VSL_SS_ED_SKEWNESS, (float*)stats->skewness);
+    if (status == VSL_STATUS_OK && stats->kurtosis) status = vslsSSEditTask(stats->task, VSL_SS_ED_KURTOSIS, (float*)stats->kurtosis);
+    if (status == VSL_STATUS_OK && stats->covariance)
+    {
+        status = vslsSSEditCovCor(stats->task, (float*)stats->mean, (float*)stats->covariance, &stats->covariance_storage, NULL, NULL);
+    }
+    if (status == VSL_STATUS_OK && stats->min) status = vslsSSEditTask(stats->task, VSL_SS_ED_MIN, (float*)stats->min);
+    if (status == VSL_STATUS_OK && stats->max) status = vslsSSEditTask(stats->task, VSL_SS_ED_MAX, (float*)stats->max);
+    if (status == VSL_STATUS_OK && (stats->estimates & VSL_SS_STREAM_QUANTS))
+    {
+        status = vslsSSEditStreamQuantiles(stats->task, &stats->quantile_count, (float*)stats->quantile_orders, (float*)stats->quantiles,
+            &stats->quantile_parameter_count, (float*)stats->quantile_parameters);
+    }
+
+    return status;
+}
+
+static int s_stats_compute(summary_statistics* stats)
+{
+    float* weights = (float*)stats->weights;
+    const float before[2] = { weights[0], weights[1] };
+    int status = VSL_STATUS_OK;
+
+    // Every call folds the block into the shared accumulated weight, so each one has to start from its value before the block.
+    if (stats->estimates & STATS_MOMENTS) status = vslsSSCompute(stats->task, stats->estimates & STATS_MOMENTS, VSL_SS_METHOD_1PASS);
+    if (status == VSL_STATUS_OK && (stats->estimates & STATS_EXTREMES))
+    {
+        weights[0] = before[0];
+        weights[1] = before[1];
+        status = vslsSSCompute(stats->task, stats->estimates & STATS_EXTREMES, VSL_SS_METHOD_FAST);
+    }
+    if (status == VSL_STATUS_OK && (stats->estimates & VSL_SS_STREAM_QUANTS))
+    {
+        weights[0] = before[0];
+        weights[1] = before[1];
+        status = vslsSSCompute(stats->task, VSL_SS_STREAM_QUANTS, VSL_SS_METHOD_SQUANTS_ZW);
+    }
+    return status;
+}
+
+static void d_stats_initialize(summary_statistics* stats, const double orders[], const double epsilon)
+{
+    const size_t p = (size_t)stats->dimension;
+    size_t i;
+
+    ((double*)stats->weights)[0] = 0.0;
+    ((double*)stats->weights)[1] = 0.0;
+
+    for (i = 0; i < p; ++i)
+    {
+        if (stats->min) ((double*)stats->min)[i] = HUGE_VAL;
+        if (stats->max) ((double*)stats->max)[i] = -HUGE_VAL;
+    }
+
+    if (stats->estimates & VSL_SS_STREAM_QUANTS)
+    {
+        memcpy(stats->quantile_orders, orders, stats->quantile_count * sizeof(double));
+        ((double*)stats->quantile_parameters)[0] = epsilon;
+    }
+}
+
+static int d_stats_register(summary_statistics* stats, const double x[])
+{
+    int status = vsldSSNewTask(&stats->task, &stats->dimension, &stats->observations, &stats->storage, x, NULL, NULL);
+    if (status != VSL_STATUS_OK) return status;
+
+    status = vsldSSEditTask(stats->task, VSL_SS_ED_ACCUM_WEIGHT, (double*)stats->weights);
+    if (status == VSL_STATUS_OK && (stats->estimates & STATS_MOMENTS))
+    {
+        status = vsldSSEditMoments(stats->task, (double*)stats->mean, (double*)stats->raw2, (double*)stats->raw3, (double*)stats->raw4,
+            (double*)stats->central2, (double*)stats->central3, (double*)stats->central4);
+    }
+    if (status == VSL_STATUS_OK && stats->skewness) status = vsldSSEditTask(stats->task, VSL_SS_ED_SKEWNESS, (double*)stats->skewness);
+    if (status == VSL_STATUS_OK && stats->kurtosis) status = vsldSSEditTask(stats->task, VSL_SS_ED_KURTOSIS, (double*)stats->kurtosis);
+    if (status == VSL_STATUS_OK && stats->covariance)
+    {
+        status = vsldSSEditCovCor(stats->task, (double*)stats->mean, (double*)stats->covariance, &stats->covariance_storage, NULL, NULL);
+    }
+    if (status == VSL_STATUS_OK && stats->min) status = vsldSSEditTask(stats->task, VSL_SS_ED_MIN, (double*)stats->min);
+    if (status == VSL_STATUS_OK && stats->max) status = vsldSSEditTask(stats->task, VSL_SS_ED_MAX, (double*)stats->max);
+    if (status == VSL_STATUS_OK && (stats->estimates & VSL_SS_STREAM_QUANTS))
+    {
+        status = vsldSSEditStreamQuantiles(stats->task, &stats->quantile_count, (double*)stats->quantile_orders, (double*)stats->quantiles,
+            &stats->quantile_parameter_count, (double*)stats->quantile_parameters);
+    }
+
+    return status;
+}
+
+static int d_stats_compute(summary_statistics* stats)
+{
+    double* weights = (double*)stats->weights;
+    const double before[2] = { weights[0], weights[1] };
+    int status = VSL_STATUS_OK;
+
+    // Every call folds the block into the shared accumulated weight, so each one has to start from its value before the block.
+    if (stats->estimates & STATS_MOMENTS) status = vsldSSCompute(stats->task, stats->estimates & STATS_MOMENTS, VSL_SS_METHOD_1PASS);
+    if (status == VSL_STATUS_OK && (stats->estimates & STATS_EXTREMES))
+    {
+        weights[0] = before[0];
+        weights[1] = before[1];
+        status = vsldSSCompute(stats->task, stats->estimates & STATS_EXTREMES, VSL_SS_METHOD_FAST);
+    }
+    if (status == VSL_STATUS_OK && (stats->estimates & VSL_SS_STREAM_QUANTS))
+    {
+        weights[0] = before[0];
+        weights[1] = before[1];
+        status = vsldSSCompute(stats->task, VSL_SS_STREAM_QUANTS, VSL_SS_METHOD_SQUANTS_ZW);
+    }
+    return status;
+}
+
+#if __cplusplus
+extern "C" {
+#endif
+
+    DLLEXPORT int s_summary_statistics_create(summary_statistics** handle, const int dimension, const int observationsInColumns,
+        const stats_estimates estimates, const int quantileCount, const float quantileOrders[], const float epsilon)
+    {
+        summary_statistics* stats;
+        *handle = NULL;
+        if (dimension <= 0 || ((estimates & VSL_SS_STREAM_QUANTS) && quantileCount <= 0)) return VSL_ERROR_BADARGS;
+
+        stats = summary_statistics_new(dimension, observationsInColumns, estimates, quantileCount, sizeof(float));
+        if (!stats) return VSL_ERROR_MEM_FAILURE;
+
+        s_stats_initialize(stats, quantileOrders, epsilon);
+        *handle = stats;
+        return VSL_STATUS_OK;
+    }
+
+    DLLEXPORT int s_summary_statistics_update(summary_statistics* handle, const int observations, const float x[])
+    {
+        int status;
+        if (observations <= 0) return VSL_STATUS_OK;
+
+        handle->observations = observations;
+        status = handle->task
+            ? vslsSSEditTask(handle->task, VSL_SS_ED_OBSERV, x)
+            : s_stats_register(handle, x);
+        if (status != VSL_STATUS_OK) return status;
+
+        return s_stats_compute(handle);
+    }
+
+    DLLEXPORT int s_summary_statistics_get(const summary_statistics* handle, const stats_estimates estimate, float result[])
+    {
+        size_t count;
+        const void* values = stats_estimate_array(handle, estimate, &count);
+        if (!values) return VSL_ERROR_BADARGS;
+
+        memcpy(result, values, count * sizeof(float));
+        return VSL_STATUS_OK;
+    }
+
+    // Total weight of the observations seen so far, i.e. their number
+    DLLEXPORT float s_summary_statistics_count(const summary_statistics* handle)
+    {
+        return ((const float*)handle->weights)[0];
+    }
+
+    DLLEXPORT int d_summary_statistics_create(summary_statistics** handle, const int dimension, const int observationsInColumns,
+        const stats_estimates estimates, const int quantileCount, const double quantileOrders[], const double epsilon)
+    {
+        summary_statistics* stats;
+        *handle = NULL;
+        if (dimension <= 0 || ((estimates & VSL_SS_STREAM_QUANTS) && quantileCount <= 0)) return VSL_ERROR_BADARGS;
+
+        stats = summary_statistics_new(dimension, observationsInColumns, estimates, quantileCount, sizeof(double));
+        if (!stats) return VSL_ERROR_MEM_FAILURE;
+
+        d_stats_initialize(stats, quantileOrders, epsilon);
+        *handle = stats;
+        return VSL_STATUS_OK;
+    }
+
+    DLLEXPORT int d_summary_statistics_update(summary_statistics* handle, const int observations, const double x[])
+    {
+        int status;
+        if (observations <= 0) return VSL_STATUS_OK;
+
+        handle->observations = observations;
+        status = handle->task
+            ? vsldSSEditTask(handle->task, VSL_SS_ED_OBSERV, x)
+            : d_stats_register(handle, x);
+        if (status != VSL_STATUS_OK) return status;
+
+        return d_stats_compute(handle);
+    }
+
+    DLLEXPORT int d_summary_statistics_get(const summary_statistics* handle, const stats_estimates estimate, double result[])
+    {
+        size_t count;
+        const void* values = stats_estimate_array(handle, estimate, &count);
+        if (!values) return VSL_ERROR_BADARGS;
+
+        memcpy(result, values, count * sizeof(double));
+        return VSL_STATUS_OK;
+    }
+
+    // Total weight of the observations seen so far, i.e. their number
+    DLLEXPORT double d_summary_statistics_count(const summary_statistics* handle)
+    {
+        return ((const double*)handle->weights)[0];
+    }
+
+    DLLEXPORT void x_summary_statistics_free(summary_statistics* handle)
+    {
+        if (handle) summary_statistics_free(handle);
+    }
+
+#if __cplusplus
+}
+#endif
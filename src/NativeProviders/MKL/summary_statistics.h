@@ -0,0 +1,42 @@
+#pragma once
+
+#include "mkl_vsl.h"
+#include "mkl_types.h"
+
+#define stats_int       MKL_INT
+#define stats_estimates MKL_INT64
+
+/*
+    A VSL Summary Statistics task updated block by block (progressive mode).
+    MKL keeps pointers to the dimensions and to all result arrays, so they live in the handle;
+    values are float or double depending on the precision the handle was created with.
+    The task itself is created on the first block, once an observation array is available.
+*/
+typedef struct
+{
+    VSLSSTaskPtr task;
+    stats_int dimension;
+    stats_int observations;
+    stats_int storage;
+    stats_int covariance_storage;
+    stats_int quantile_count;
+    stats_int quantile_parameter_count;
+    stats_estimates estimates;
+    size_t value_size;
+    void* weights;
+    void* mean;
+    void* raw2;
+    void* raw3;
+    void* raw4;
+    void* central2;
+    void* central3;
+    void* central4;
+    void* skewness;
+    void* kurtosis;
+    void* covariance;
+    void* min;
+    void* max;
+    void* quantile_orders;
+    void* quantiles;
+    void* quantile_parameters;
+} summary_statistics;
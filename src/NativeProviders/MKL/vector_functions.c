@@ -85,6 +85,682 @@ DLLEXPORT void z_vector_power(const int n, const MKL_Complex16 x[], const MKL_Co
 	vzPow(n, x, y, result);
 }
 
+/* One-argument functions, result[i] = f(x[i]); only for the precisions MKL VML defines. */
+
+DLLEXPORT void s_vector_exp(const int n, const float x[], float result[]) {
+	vsExp(n, x, result);
+}
+
+DLLEXPORT void s_vector_log(const int n, const float x[], float result[]) {
+	vsLn(n, x, result);
+}
+
+DLLEXPORT void s_vector_sqrt(const int n, const float x[], float result[]) {
+	vsSqrt(n, x, result);
+}
+
+DLLEXPORT void s_vector_inverse_sqrt(const int n, const float x[], float result[]) {
+	vsInvSqrt(n, x, result);
+}
+
+DLLEXPORT void s_vector_sin(const int n, const float x[], float result[]) {
+	vsSin(n, x, result);
+}
+
+DLLEXPORT void s_vector_cos(const int n, const float x[], float result[]) {
+	vsCos(n, x, result);
+}
+
+DLLEXPORT void s_vector_tanh(const int n, const float x[], float result[]) {
+	vsTanh(n, x, result);
+}
+
+DLLEXPORT void s_vector_erf(const int n, const float x[], float result[]) {
+	vsErf(n, x, result);
+}
+
+DLLEXPORT void s_vector_erf_inverse(const int n, const float x[], float result[]) {
+	vsErfInv(n, x, result);
+}
+
+DLLEXPORT void s_vector_cdf_normal(const int n, const float x[], float result[]) {
+	vsCdfNorm(n, x, result);
+}
+
+DLLEXPORT void s_vector_log_gamma(const int n, const float x[], float result[]) {
+	vsLGamma(n, x, result);
+}
+
+DLLEXPORT void s_vector_inverse(const int n, const float x[], float result[]) {
+	vsInv(n, x, result);
+}
+
+DLLEXPORT void s_vector_sin_cos(const int n, const float x[], float sin[], float cos[]) {
+	vsSinCos(n, x, sin, cos);
+}
+
+DLLEXPORT void s_vector_abs(const int n, const float x[], float result[]) {
+	vsAbs(n, x, result);
+}
+
+DLLEXPORT void d_vector_exp(const int n, const double x[], double result[]) {
+	vdExp(n, x, result);
+}
+
+DLLEXPORT void d_vector_log(const int n, const double x[], double result[]) {
+	vdLn(n, x, result);
+}
+
+DLLEXPORT void d_vector_sqrt(const int n, const double x[], double result[]) {
+	vdSqrt(n, x, result);
+}
+
+DLLEXPORT void d_vector_inverse_sqrt(const int n, const double x[], double result[]) {
+	vdInvSqrt(n, x, result);
+}
+
+DLLEXPORT void d_vector_sin(const int n, const double x[], double result[]) {
+	vdSin(n, x, result);
+}
+
+DLLEXPORT void d_vector_cos(const int n, const double x[], double result[]) {
+	vdCos(n, x, result);
+}
+
+DLLEXPORT void d_vector_tanh(const int n, const double x[], double result[]) {
+	vdTanh(n, x, result);
+}
+
+DLLEXPORT void d_vector_erf(const int n, const double x[], double result[]) {
+	vdErf(n, x, result);
+}
+
+DLLEXPORT void d_vector_erf_inverse(const int n, const double x[], double result[]) {
+	vdErfInv(n, x, result);
+}
+
+DLLEXPORT void d_vector_cdf_normal(const int n, const double x[], double result[]) {
+	vdCdfNorm(n, x, result);
+}
+
+DLLEXPORT void d_vector_log_gamma(const int n, const double x[], double result[]) {
+	vdLGamma(n, x, result);
+}
+
+DLLEXPORT void d_vector_inverse(const int n, const double x[], double result[]) {
+	vdInv(n, x, result);
+}
+
+DLLEXPORT void d_vector_sin_cos(const int n, const double x[], double sin[], double cos[]) {
+	vdSinCos(n, x, sin, cos);
+}
+
+DLLEXPORT void d_vector_abs(const int n, const double x[], double result[]) {
+	vdAbs(n, x, result);
+}
+
+DLLEXPORT void c_vector_exp(const int n, const MKL_Complex8 x[], MKL_Complex8 result[]) {
+	vcExp(n, x, result);
+}
+
+DLLEXPORT void c_vector_log(const int n, const MKL_Complex8 x[], MKL_Complex8 result[]) {
+	vcLn(n, x, result);
+}
+
+DLLEXPORT void c_vector_sqrt(const int n, const MKL_Complex8 x[], MKL_Complex8 result[]) {
+	vcSqrt(n, x, result);
+}
+
+DLLEXPORT void c_vector_sin(const int n, const MKL_Complex8 x[], MKL_Complex8 result[]) {
+	vcSin(n, x, result);
+}
+
+DLLEXPORT void c_vector_cos(const int n, const MKL_Complex8 x[], MKL_Complex8 result[]) {
+	vcCos(n, x, result);
+}
+
+DLLEXPORT void c_vector_tanh(const int n, const MKL_Complex8 x[], MKL_Complex8 result[]) {
+	vcTanh(n, x, result);
+}
+
+DLLEXPORT void c_vector_abs(const int n, const MKL_Complex8 x[], float result[]) {
+	vcAbs(n, x, result);
+}
+
+DLLEXPORT void z_vector_exp(const int n, const MKL_Complex16 x[], MKL_Complex16 result[]) {
+	vzExp(n, x, result);
+}
+
+DLLEXPORT void z_vector_log(const int n, const MKL_Complex16 x[], MKL_Complex16 result[]) {
+	vzLn(n, x, result);
+}
+
+DLLEXPORT void z_vector_sqrt(const int n, const MKL_Complex16 x[], MKL_Complex16 result[]) {
+	vzSqrt(n, x, result);
+}
+
+DLLEXPORT void z_vector_sin(const int n, const MKL_Complex16 x[], MKL_Complex16 result[]) {
+	vzSin(n, x, result);
+}
+
+DLLEXPORT void z_vector_cos(const int n, const MKL_Complex16 x[], MKL_Complex16 result[]) {
+	vzCos(n, x, result);
+}
+
+DLLEXPORT void z_vector_tanh(const int n, const MKL_Complex16 x[], MKL_Complex16 result[]) {
+	vzTanh(n, x, result);
+}
+
+DLLEXPORT void z_vector_abs(const int n, const MKL_Complex16 x[], double result[]) {
+	vzAbs(n, x, result);
+}
+
+/*
+	Per-call accuracy mode (VML_LA, VML_HA or VML_EP, optionally combined with VML_FTZDAZ or error mode bits).
+	Unlike set_vml_mode this does not change the mode of other calls or threads.
+*/
+
+DLLEXPORT void s_vector_add_mode(const int n, const float x[], const float y[], float result[], const MKL_UINT mode) {
+	vmsAdd(n, x, y, result, mode);
+}
+
+DLLEXPORT void s_vector_subtract_mode(const int n, const float x[], const float y[], float result[], const MKL_UINT mode) {
+	vmsSub(n, x, y, result, mode);
+}
+
+DLLEXPORT void s_vector_multiply_mode(const int n, const float x[], const float y[], float result[], const MKL_UINT mode) {
+	vmsMul(n, x, y, result, mode);
+}
+
+DLLEXPORT void s_vector_divide_mode(const int n, const float x[], const float y[], float result[], const MKL_UINT mode) {
+	vmsDiv(n, x, y, result, mode);
+}
+
+DLLEXPORT void s_vector_power_mode(const int n, const float x[], const float y[], float result[], const MKL_UINT mode) {
+	vmsPow(n, x, y, result, mode);
+}
+
+DLLEXPORT void d_vector_add_mode(const int n, const double x[], const double y[], double result[], const MKL_UINT mode) {
+	vmdAdd(n, x, y, result, mode);
+}
+
+DLLEXPORT void d_vector_subtract_mode(const int n, const double x[], const double y[], double result[], const MKL_UINT mode) {
+	vmdSub(n, x, y, result, mode);
+}
+
+DLLEXPORT void d_vector_multiply_mode(const int n, const double x[], const double y[], double result[], const MKL_UINT mode) {
+	vmdMul(n, x, y, result, mode);
+}
+
+DLLEXPORT void d_vector_divide_mode(const int n, const double x[], const double y[], double result[], const MKL_UINT mode) {
+	vmdDiv(n, x, y, result, mode);
+}
+
+DLLEXPORT void d_vector_power_mode(const int n, const double x[], const double y[], double result[], const MKL_UINT mode) {
+	vmdPow(n, x, y, result, mode);
+}
+
+DLLEXPORT void c_vector_add_mode(const int n, const MKL_Complex8 x[], const MKL_Complex8 y[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcAdd(n, x, y, result, mode);
+}
+
+DLLEXPORT void c_vector_subtract_mode(const int n, const MKL_Complex8 x[], const MKL_Complex8 y[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcSub(n, x, y, result, mode);
+}
+
+DLLEXPORT void c_vector_multiply_mode(const int n, const MKL_Complex8 x[], const MKL_Complex8 y[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcMul(n, x, y, result, mode);
+}
+
+DLLEXPORT void c_vector_divide_mode(const int n, const MKL_Complex8 x[], const MKL_Complex8 y[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcDiv(n, x, y, result, mode);
+}
+
+DLLEXPORT void c_vector_power_mode(const int n, const MKL_Complex8 x[], const MKL_Complex8 y[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcPow(n, x, y, result, mode);
+}
+
+DLLEXPORT void z_vector_add_mode(const int n, const MKL_Complex16 x[], const MKL_Complex16 y[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzAdd(n, x, y, result, mode);
+}
+
+DLLEXPORT void z_vector_subtract_mode(const int n, const MKL_Complex16 x[], const MKL_Complex16 y[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzSub(n, x, y, result, mode);
+}
+
+DLLEXPORT void z_vector_multiply_mode(const int n, const MKL_Complex16 x[], const MKL_Complex16 y[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzMul(n, x, y, result, mode);
+}
+
+DLLEXPORT void z_vector_divide_mode(const int n, const MKL_Complex16 x[], const MKL_Complex16 y[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzDiv(n, x, y, result, mode);
+}
+
+DLLEXPORT void z_vector_power_mode(const int n, const MKL_Complex16 x[], const MKL_Complex16 y[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzPow(n, x, y, result, mode);
+}
+
+DLLEXPORT void s_vector_exp_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsExp(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_log_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsLn(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_sqrt_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsSqrt(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_inverse_sqrt_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsInvSqrt(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_sin_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsSin(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_cos_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsCos(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_tanh_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsTanh(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_erf_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsErf(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_erf_inverse_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsErfInv(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_cdf_normal_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsCdfNorm(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_log_gamma_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsLGamma(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_inverse_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsInv(n, x, result, mode);
+}
+
+DLLEXPORT void s_vector_sin_cos_mode(const int n, const float x[], float sin[], float cos[], const MKL_UINT mode) {
+	vmsSinCos(n, x, sin, cos, mode);
+}
+
+DLLEXPORT void s_vector_abs_mode(const int n, const float x[], float result[], const MKL_UINT mode) {
+	vmsAbs(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_exp_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdExp(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_log_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdLn(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_sqrt_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdSqrt(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_inverse_sqrt_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdInvSqrt(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_sin_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdSin(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_cos_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdCos(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_tanh_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdTanh(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_erf_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdErf(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_erf_inverse_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdErfInv(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_cdf_normal_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdCdfNorm(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_log_gamma_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdLGamma(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_inverse_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdInv(n, x, result, mode);
+}
+
+DLLEXPORT void d_vector_sin_cos_mode(const int n, const double x[], double sin[], double cos[], const MKL_UINT mode) {
+	vmdSinCos(n, x, sin, cos, mode);
+}
+
+DLLEXPORT void d_vector_abs_mode(const int n, const double x[], double result[], const MKL_UINT mode) {
+	vmdAbs(n, x, result, mode);
+}
+
+DLLEXPORT void c_vector_exp_mode(const int n, const MKL_Complex8 x[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcExp(n, x, result, mode);
+}
+
+DLLEXPORT void c_vector_log_mode(const int n, const MKL_Complex8 x[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcLn(n, x, result, mode);
+}
+
+DLLEXPORT void c_vector_sqrt_mode(const int n, const MKL_Complex8 x[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcSqrt(n, x, result, mode);
+}
+
+DLLEXPORT void c_vector_sin_mode(const int n, const MKL_Complex8 x[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcSin(n, x, result, mode);
+}
+
+DLLEXPORT void c_vector_cos_mode(const int n, const MKL_Complex8 x[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcCos(n, x, result, mode);
+}
+
+DLLEXPORT void c_vector_tanh_mode(const int n, const MKL_Complex8 x[], MKL_Complex8 result[], const MKL_UINT mode) {
+	vmcTanh(n, x, result, mode);
+}
+
+DLLEXPORT void c_vector_abs_mode(const int n, const MKL_Complex8 x[], float result[], const MKL_UINT mode) {
+	vmcAbs(n, x, result, mode);
+}
+
+DLLEXPORT void z_vector_exp_mode(const int n, const MKL_Complex16 x[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzExp(n, x, result, mode);
+}
+
+DLLEXPORT void z_vector_log_mode(const int n, const MKL_Complex16 x[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzLn(n, x, result, mode);
+}
+
+DLLEXPORT void z_vector_sqrt_mode(const int n, const MKL_Complex16 x[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzSqrt(n, x, result, mode);
+}
+
+DLLEXPORT void z_vector_sin_mode(const int n, const MKL_Complex16 x[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzSin(n, x, result, mode);
+}
+
+DLLEXPORT void z_vector_cos_mode(const int n, const MKL_Complex16 x[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzCos(n, x, result, mode);
+}
+
+DLLEXPORT void z_vector_tanh_mode(const int n, const MKL_Complex16 x[], MKL_Complex16 result[], const MKL_UINT mode) {
+	vmzTanh(n, x, result, mode);
+}
+
+DLLEXPORT void z_vector_abs_mode(const int n, const MKL_Complex16 x[], double result[], const MKL_UINT mode) {
+	vmzAbs(n, x, result, mode);
+}
+
+/*
+	Strided variants with a per-call mode: element i is read from x[i*incx] (and y[i*incy]) and written to result[i*incResult],
+	for example to operate on a row of a column-major matrix in place.
+*/
+
+DLLEXPORT void s_vector_add_strided(const int n, const float x[], const int incx, const float y[], const int incy, float result[], const int incResult, const MKL_UINT mode) {
+	vmsAddI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_subtract_strided(const int n, const float x[], const int incx, const float y[], const int incy, float result[], const int incResult, const MKL_UINT mode) {
+	vmsSubI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_multiply_strided(const int n, const float x[], const int incx, const float y[], const int incy, float result[], const int incResult, const MKL_UINT mode) {
+	vmsMulI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_divide_strided(const int n, const float x[], const int incx, const float y[], const int incy, float result[], const int incResult, const MKL_UINT mode) {
+	vmsDivI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_power_strided(const int n, const float x[], const int incx, const float y[], const int incy, float result[], const int incResult, const MKL_UINT mode) {
+	vmsPowI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_add_strided(const int n, const double x[], const int incx, const double y[], const int incy, double result[], const int incResult, const MKL_UINT mode) {
+	vmdAddI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_subtract_strided(const int n, const double x[], const int incx, const double y[], const int incy, double result[], const int incResult, const MKL_UINT mode) {
+	vmdSubI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_multiply_strided(const int n, const double x[], const int incx, const double y[], const int incy, double result[], const int incResult, const MKL_UINT mode) {
+	vmdMulI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_divide_strided(const int n, const double x[], const int incx, const double y[], const int incy, double result[], const int incResult, const MKL_UINT mode) {
+	vmdDivI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_power_strided(const int n, const double x[], const int incx, const double y[], const int incy, double result[], const int incResult, const MKL_UINT mode) {
+	vmdPowI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_add_strided(const int n, const MKL_Complex8 x[], const int incx, const MKL_Complex8 y[], const int incy, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcAddI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_subtract_strided(const int n, const MKL_Complex8 x[], const int incx, const MKL_Complex8 y[], const int incy, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcSubI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_multiply_strided(const int n, const MKL_Complex8 x[], const int incx, const MKL_Complex8 y[], const int incy, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcMulI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_divide_strided(const int n, const MKL_Complex8 x[], const int incx, const MKL_Complex8 y[], const int incy, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcDivI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_power_strided(const int n, const MKL_Complex8 x[], const int incx, const MKL_Complex8 y[], const int incy, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcPowI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_add_strided(const int n, const MKL_Complex16 x[], const int incx, const MKL_Complex16 y[], const int incy, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzAddI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_subtract_strided(const int n, const MKL_Complex16 x[], const int incx, const MKL_Complex16 y[], const int incy, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzSubI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_multiply_strided(const int n, const MKL_Complex16 x[], const int incx, const MKL_Complex16 y[], const int incy, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzMulI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_divide_strided(const int n, const MKL_Complex16 x[], const int incx, const MKL_Complex16 y[], const int incy, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzDivI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_power_strided(const int n, const MKL_Complex16 x[], const int incx, const MKL_Complex16 y[], const int incy, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzPowI(n, x, incx, y, incy, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_exp_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsExpI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_log_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsLnI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_sqrt_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsSqrtI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_inverse_sqrt_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsInvSqrtI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_sin_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsSinI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_cos_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsCosI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_tanh_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsTanhI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_erf_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsErfI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_erf_inverse_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsErfInvI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_cdf_normal_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsCdfNormI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_log_gamma_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsLGammaI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_inverse_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsInvI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void s_vector_sin_cos_strided(const int n, const float x[], const int incx, float sin[], const int incSin, float cos[], const int incCos, const MKL_UINT mode) {
+	vmsSinCosI(n, x, incx, sin, incSin, cos, incCos, mode);
+}
+
+DLLEXPORT void s_vector_abs_strided(const int n, const float x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmsAbsI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_exp_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdExpI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_log_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdLnI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_sqrt_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdSqrtI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_inverse_sqrt_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdInvSqrtI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_sin_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdSinI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_cos_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdCosI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_tanh_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdTanhI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_erf_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdErfI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_erf_inverse_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdErfInvI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_cdf_normal_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdCdfNormI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_log_gamma_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdLGammaI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_inverse_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdInvI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void d_vector_sin_cos_strided(const int n, const double x[], const int incx, double sin[], const int incSin, double cos[], const int incCos, const MKL_UINT mode) {
+	vmdSinCosI(n, x, incx, sin, incSin, cos, incCos, mode);
+}
+
+DLLEXPORT void d_vector_abs_strided(const int n, const double x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmdAbsI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_exp_strided(const int n, const MKL_Complex8 x[], const int incx, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcExpI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_log_strided(const int n, const MKL_Complex8 x[], const int incx, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcLnI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_sqrt_strided(const int n, const MKL_Complex8 x[], const int incx, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcSqrtI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_sin_strided(const int n, const MKL_Complex8 x[], const int incx, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcSinI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_cos_strided(const int n, const MKL_Complex8 x[], const int incx, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcCosI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_tanh_strided(const int n, const MKL_Complex8 x[], const int incx, MKL_Complex8 result[], const int incResult, const MKL_UINT mode) {
+	vmcTanhI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void c_vector_abs_strided(const int n, const MKL_Complex8 x[], const int incx, float result[], const int incResult, const MKL_UINT mode) {
+	vmcAbsI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_exp_strided(const int n, const MKL_Complex16 x[], const int incx, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzExpI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_log_strided(const int n, const MKL_Complex16 x[], const int incx, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzLnI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_sqrt_strided(const int n, const MKL_Complex16 x[], const int incx, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzSqrtI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_sin_strided(const int n, const MKL_Complex16 x[], const int incx, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzSinI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_cos_strided(const int n, const MKL_Complex16 x[], const int incx, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzCosI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_tanh_strided(const int n, const MKL_Complex16 x[], const int incx, MKL_Complex16 result[], const int incResult, const MKL_UINT mode) {
+	vmzTanhI(n, x, incx, result, incResult, mode);
+}
+
+DLLEXPORT void z_vector_abs_strided(const int n, const MKL_Complex16 x[], const int incx, double result[], const int incResult, const MKL_UINT mode) {
+	vmzAbsI(n, x, incx, result, incResult, mode);
+}
+
 #if __cplusplus
 }
 #endif
@@ -4,12 +4,29 @@ export OPENMP=$INTEL/lib
 export OUT=../../../out/MKL/OSX
 
 mkdir -p $OUT/x64
+mkdir -p $OUT/x64-ILP64
 mkdir -p $OUT/x86
 
-clang++ -std=c++11 -D_M_X64 -DGCC -m64 --shared -fPIC -o $OUT/x64/libMathNetNumericsMKL.dylib -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../Common/lapack.cpp ../MKL/fft.cpp  $MKL/lib/libmkl_intel_lp64.a $MKL/lib/libmkl_core.a $MKL/lib/libmkl_intel_thread.a -L$OPENMP -liomp5 -lpthread -lm
+# Kernels picked at runtime (see ../Common/simd_dispatch.h) are compiled separately with their instruction set enabled
+export OBJ=$OUT/obj
+mkdir -p $OBJ/x64
+mkdir -p $OBJ/x86
+clang++ -std=c++11 -D_M_X64 -DGCC -m64 -fPIC -mavx2 -mfma -c -o $OBJ/x64/reduction_kernels_avx2.o -I../Common ../Common/reduction_kernels_avx2.cpp
+clang++ -std=c++11 -D_M_X64 -DGCC -m64 -fPIC -mavx512f -c -o $OBJ/x64/reduction_kernels_avx512.o -I../Common ../Common/reduction_kernels_avx512.cpp
+clang++ -std=c++11 -D_M_IX86 -DGCC -m32 -fPIC -mavx2 -mfma -c -o $OBJ/x86/reduction_kernels_avx2.o -I../Common ../Common/reduction_kernels_avx2.cpp
+clang++ -std=c++11 -D_M_IX86 -DGCC -m32 -fPIC -mavx512f -c -o $OBJ/x86/reduction_kernels_avx512.o -I../Common ../Common/reduction_kernels_avx512.cpp
+
+clang++ -std=c++11 -D_M_X64 -DGCC -m64 --shared -fPIC -o $OUT/x64/libMathNetNumericsMKL.dylib -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../MKL/blas_batch.c ../MKL/blas_extensions.c ../MKL/blas_jit.c ../MKL/blas_pack.c ../MKL/blas_transpose.c ../MKL/sparse_blas.c ../MKL/summary_statistics.c ../MKL/random.c ../MKL/convolution.c ../MKL/data_fitting.c ../Common/reductions.cpp $OBJ/x64/reduction_kernels_avx2.o $OBJ/x64/reduction_kernels_avx512.o ../Common/lapack.cpp ../MKL/fft.cpp  $MKL/lib/libmkl_intel_lp64.a $MKL/lib/libmkl_core.a $MKL/lib/libmkl_intel_thread.a -L$OPENMP -liomp5 -lpthread -lm
 
 cp $OPENMP/libiomp5.dylib  $OUT/x64/
 
-clang++ -std=c++11 -D_M_IX86 -DGCC -m32 --shared -fPIC -o $OUT/x86/libMathNetNumericsMKL.dylib -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../Common/lapack.cpp ../MKL/fft.cpp  $MKL/lib/libmkl_intel_lp64.a $MKL/lib/libmkl_core.a $MKL/lib/libmkl_intel_thread.a -L$OPENMP -liomp5 -lpthread -lm
+# ILP64 (64-bit MKL_INT) build for native consumers only; the managed provider refuses to load it
+clang++ -std=c++11 -D_M_X64 -DMKL_ILP64 -DGCC -m64 --shared -fPIC -o $OUT/x64-ILP64/libMathNetNumericsMKL.dylib -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../MKL/blas_batch.c ../MKL/blas_extensions.c ../MKL/blas_jit.c ../MKL/blas_pack.c ../MKL/blas_transpose.c ../MKL/sparse_blas.c ../MKL/summary_statistics.c ../MKL/random.c ../MKL/convolution.c ../MKL/data_fitting.c ../Common/reductions.cpp $OBJ/x64/reduction_kernels_avx2.o $OBJ/x64/reduction_kernels_avx512.o ../Common/lapack.cpp ../MKL/fft.cpp  $MKL/lib/libmkl_intel_ilp64.a $MKL/lib/libmkl_core.a $MKL/lib/libmkl_intel_thread.a -L$OPENMP -liomp5 -lpthread -lm
+
+cp $OPENMP/libiomp5.dylib  $OUT/x64-ILP64/
+
+clang++ -std=c++11 -D_M_IX86 -DGCC -m32 --shared -fPIC -o $OUT/x86/libMathNetNumericsMKL.dylib -I$MKL/include -I../Common -I../MKL ../MKL/memory.c ../MKL/capabilities.cpp ../MKL/vector_functions.c ../Common/blas.c ../MKL/blas_batch.c ../MKL/blas_extensions.c ../MKL/blas_jit.c ../MKL/blas_pack.c ../MKL/blas_transpose.c ../MKL/sparse_blas.c ../MKL/summary_statistics.c ../MKL/random.c ../MKL/convolution.c ../MKL/data_fitting.c ../Common/reductions.cpp $OBJ/x86/reduction_kernels_avx2.o $OBJ/x86/reduction_kernels_avx512.o ../Common/lapack.cpp ../MKL/fft.cpp  $MKL/lib/libmkl_intel_lp64.a $MKL/lib/libmkl_core.a $MKL/lib/libmkl_intel_thread.a -L$OPENMP -liomp5 -lpthread -lm
 
 cp $OPENMP/libiomp5.dylib  $OUT/x86/
+
+rm -rf $OBJ
@@ -5,3 +5,7 @@
 #define blas_int blasint
 #define blas_complex_float openblas_complex_float
 #define blas_complex_double openblas_complex_double
+
+// OpenBLAS runs a GEMM on the calling thread up to this m*n*k (SMP_THRESHOLD_MIN * GEMM_MULTITHREAD_THRESHOLD
+// in interface/gemm.c, with the default threshold of 4) and threads it beyond.
+#define BLAS_THREADING_THRESHOLD (65536LL * 4)
@@ -20,6 +20,9 @@ extern "C" {
 		case 0:	return 0;
 		case 1:	return -1;
 
+		case 4: return sizeof(size_t);    // 4 (x86), 8 (x64)
+		case 5: return sizeof(blasint);   // 4 (LP64), 8 (ILP64, native consumers only)
+
 		// PLATFORM
 		case 8:
 #ifdef _M_IX86
@@ -46,7 +49,13 @@ extern "C" {
 
 		// LINEAR ALGEBRA
 		case 128: return 1;	// basic dense linear algebra (major - breaking)
-		case 129: return 0;	// basic dense linear algebra (minor - non-breaking)
+		case 129: return 10;	// basic dense linear algebra (minor - non-breaking)
+		case 130: return 0;	// vector functions (major - breaking)
+		case 131: return 2;	// vector functions (minor - non-breaking)
+
+		// STATISTICS
+		case 642: return 1;	// random number streams (major - breaking, Philox4x32-10 only)
+		case 643: return 0;	// random number streams (minor - non-breaking)
 
 		default: return 0; // unknown or not supported
 
@@ -0,0 +1,162 @@
+// <copyright file="OpenBlasMatrixMultiplyTriangleTests.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// https://numerics.mathdotnet.com
+// https://github.com/mathnet/mathnet-numerics
+//
+// Copyright (c) 2009-2026 Math.NET
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+#if OPENBLAS
+
+using System;
+using MathNet.Numerics.Providers.LinearAlgebra;
+using MathNet.Numerics.Providers.OpenBLAS;
+using NUnit.Framework;
+using Complex = System.Numerics.Complex;
+
+namespace MathNet.Numerics.Tests.Providers.LinearAlgebra.Double
+{
+    /// <summary>
+    /// Tests of the recursive gemmt of the OpenBLAS provider and its optional mirror step.
+    /// </summary>
+    [TestFixture, Category("LAProvider")]
+    public class OpenBlasMatrixMultiplyTriangleTests
+    {
+        const int Upper = 121;
+        const int Lower = 122;
+
+        /// <summary>
+        /// Column-major rows x columns matrix with distinct entries.
+        /// </summary>
+        static double[] Sequence(int rows, int columns)
+        {
+            var a = new double[rows*columns];
+            for (int i = 0; i < a.Length; i++)
+            {
+                a[i] = i + 1;
+            }
+
+            return a;
+        }
+
+        /// <summary>
+        /// n is large enough for the triangle to be split recursively into smaller triangles and GEMM rectangles.
+        /// </summary>
+        [TestCase(Upper, Transpose.DontTranspose, Transpose.DontTranspose, 67, 13)]
+        [TestCase(Lower, Transpose.DontTranspose, Transpose.DontTranspose, 67, 13)]
+        [TestCase(Upper, Transpose.Transpose, Transpose.DontTranspose, 40, 7)]
+        [TestCase(Lower, Transpose.DontTranspose, Transpose.Transpose, 33, 21)]
+        [TestCase(Lower, Transpose.Transpose, Transpose.Transpose, 16, 5)]
+        public void MatrixMultiplyTriangle(int uplo, Transpose transA, Transpose transB, int n, int k)
+        {
+            var x = new double[n*k];
+            var y = new double[k*n];
+            for (int i = 0; i < x.Length; i++)
+            {
+                x[i] = (i*7)%11 - 5;
+                y[i] = (i*5)%13 - 6;
+            }
+
+            var c = Sequence(n, n);
+            var expected = (double[])c.Clone();
+            SafeNativeMethods.d_matrix_multiply(transA, transB, n, n, k, 2.0, x, y, 0.5, expected);
+
+            var actual = (double[])c.Clone();
+            SafeNativeMethods.d_matrix_multiply_triangle(uplo, transA, transB, n, k, 2.0, x, y, 0.5, actual, false);
+
+            for (int j = 0; j < n; j++)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    bool inTriangle = uplo == Upper ? i <= j : i >= j;
+                    Assert.That(actual[i + j*n], Is.EqualTo(inTriangle ? expected[i + j*n] : c[i + j*n]), $"({i},{j})");
+                }
+            }
+        }
+
+        [TestCase(Upper, 50)]
+        [TestCase(Lower, 50)]
+        public void MatrixMultiplyTriangleMirrorsHermitianProduct(int uplo, int n)
+        {
+            const int k = 9;
+            var x = new Complex[n*k];
+            for (int i = 0; i < x.Length; i++)
+            {
+                x[i] = new Complex((i*7)%11 - 5, (i*3)%5 - 2);
+            }
+
+            // x*x^H is Hermitian, so mirroring the computed triangle must reproduce the full product.
+            var expected = new Complex[n*n];
+            SafeNativeMethods.z_matrix_multiply(Transpose.DontTranspose, Transpose.ConjugateTranspose, n, n, k, Complex.One, x, x, Complex.Zero, expected);
+
+            var actual = new Complex[n*n];
+            SafeNativeMethods.z_matrix_multiply_triangle(uplo, Transpose.DontTranspose, Transpose.ConjugateTranspose, n, k, Complex.One, x, x, Complex.Zero, actual, true);
+            Assert.That(actual, Is.EqualTo(expected));
+
+            // x*x^T is complex symmetric: the mirror must not conjugate.
+            SafeNativeMethods.z_matrix_multiply(Transpose.DontTranspose, Transpose.Transpose, n, n, k, Complex.One, x, x, Complex.Zero, expected);
+            SafeNativeMethods.z_matrix_multiply_triangle(uplo, Transpose.DontTranspose, Transpose.Transpose, n, k, Complex.One, x, x, Complex.Zero, actual, true);
+            Assert.That(actual, Is.EqualTo(expected));
+        }
+
+        /// <summary>
+        /// alpha*x*x^H + beta*C is not Hermitian for complex alpha or beta, so mirroring must yield the full product.
+        /// alpha*x*x^T stays symmetric for any alpha.
+        /// </summary>
+        [TestCase(Upper, 40)]
+        [TestCase(Lower, 40)]
+        public void MatrixMultiplyTriangleMirrorsWithComplexScalars(int uplo, int n)
+        {
+            const int k = 6;
+            var x = new Complex[n*k];
+            var c = new Complex[n*n];
+            for (int i = 0; i < x.Length; i++)
+            {
+                x[i] = new Complex((i*7)%11 - 5, (i*3)%5 - 2);
+            }
+
+            for (int i = 0; i < c.Length; i++)
+            {
+                c[i] = new Complex(i%9 - 4, i%7 - 3);
+            }
+
+            var alpha = new Complex(1, 2);
+            var beta = new Complex(0.5, -1);
+
+            var expected = (Complex[])c.Clone();
+            SafeNativeMethods.z_matrix_multiply(Transpose.DontTranspose, Transpose.ConjugateTranspose, n, n, k, alpha, x, x, beta, expected);
+            var actual = (Complex[])c.Clone();
+            SafeNativeMethods.z_matrix_multiply_triangle(uplo, Transpose.DontTranspose, Transpose.ConjugateTranspose, n, k, alpha, x, x, beta, actual, true);
+            Assert.That(actual, Is.EqualTo(expected));
+
+            expected = new Complex[n*n];
+            SafeNativeMethods.z_matrix_multiply(Transpose.DontTranspose, Transpose.Transpose, n, n, k, alpha, x, x, Complex.Zero, expected);
+            actual = new Complex[n*n];
+            SafeNativeMethods.z_matrix_multiply_triangle(uplo, Transpose.DontTranspose, Transpose.Transpose, n, k, alpha, x, x, Complex.Zero, actual, true);
+            Assert.That(actual, Is.EqualTo(expected));
+        }
+    }
+}
+
+#endif
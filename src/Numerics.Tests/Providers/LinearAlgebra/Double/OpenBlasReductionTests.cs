@@ -0,0 +1,139 @@
+// <copyright file="OpenBlasReductionTests.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// https://numerics.mathdotnet.com
+// https://github.com/mathnet/mathnet-numerics
+//
+// Copyright (c) 2009-2026 Math.NET
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+#if OPENBLAS
+
+using System;
+using MathNet.Numerics.Providers.OpenBLAS;
+using NUnit.Framework;
+
+namespace MathNet.Numerics.Tests.Providers.LinearAlgebra.Double
+{
+    /// <summary>
+    /// Tests of the SIMD reductions of the OpenBLAS provider: chunked sums, and NaN-skipping
+    /// extreme values that report the first index of a tie.
+    /// </summary>
+    [TestFixture, Category("LAProvider")]
+    public class OpenBlasReductionTests
+    {
+        /// <summary>
+        /// Long enough to be reduced in several chunks on several threads.
+        /// </summary>
+        [TestCase(0)]
+        [TestCase(7)]
+        [TestCase(200003)]
+        public void VectorSum(int n)
+        {
+            var x = new double[n];
+            double sum = 0, squares = 0;
+            for (int i = 0; i < n; i++)
+            {
+                x[i] = i%17 - 8;
+                sum += x[i];
+                squares += x[i]*x[i];
+            }
+
+            Assert.That(SafeNativeMethods.d_vector_sum(n, x), Is.EqualTo(sum));
+            Assert.That(SafeNativeMethods.d_vector_sum_squares(n, x), Is.EqualTo(squares));
+        }
+
+        [Test]
+        public void VectorExtremeIndexReturnsFirstAndIgnoresNaN()
+        {
+            var x = new[] { double.NaN, 3.0, 1.0, 4.0, 1.0, double.NaN, 4.0 };
+
+            Assert.That(SafeNativeMethods.d_vector_min_index(x.Length, x, out double min), Is.EqualTo(2));
+            Assert.That(min, Is.EqualTo(1.0));
+            Assert.That(SafeNativeMethods.d_vector_max_index(x.Length, x, out double max), Is.EqualTo(3));
+            Assert.That(max, Is.EqualTo(4.0));
+
+            var xf = Array.ConvertAll(x, v => (float)v);
+            Assert.That(SafeNativeMethods.s_vector_min_index(xf.Length, xf, out float minf), Is.EqualTo(2));
+            Assert.That(minf, Is.EqualTo(1.0f));
+        }
+
+        [Test]
+        public void VectorExtremeIndexAcrossChunks()
+        {
+            var x = new double[300000];
+            for (int i = 0; i < x.Length; i++)
+            {
+                x[i] = i%1000;
+            }
+
+            x[1] = double.NaN;
+            x[70000] = -5.0;
+            x[250000] = -5.0;
+            x[130000] = 2000.0;
+            x[290000] = 2000.0;
+
+            Assert.That(SafeNativeMethods.d_vector_min_index(x.Length, x, out double min), Is.EqualTo(70000));
+            Assert.That(min, Is.EqualTo(-5.0));
+            Assert.That(SafeNativeMethods.d_vector_max_index(x.Length, x, out double max), Is.EqualTo(130000));
+            Assert.That(max, Is.EqualTo(2000.0));
+        }
+
+        [Test]
+        public void VectorExtremeIndexOfAllNaNAndEmpty()
+        {
+            var x = new[] { double.NaN, double.NaN, double.NaN };
+            Assert.That(SafeNativeMethods.d_vector_min_index(x.Length, x, out double value), Is.EqualTo(0));
+            Assert.That(value, Is.NaN);
+
+            Assert.That(SafeNativeMethods.d_vector_max_index(0, new double[0], out value), Is.EqualTo(-1));
+        }
+
+        [Test]
+        public void MatrixExtremeIndexAlongBothAxes()
+        {
+            // column-major 3x4:
+            //   NaN  2    NaN  2
+            //   1    2    NaN  0
+            //   1    NaN  NaN  5
+            var a = new[] { double.NaN, 1.0, 1.0, 2.0, 2.0, double.NaN, double.NaN, double.NaN, double.NaN, 2.0, 0.0, 5.0 };
+
+            var indices = new int[4];
+            var values = new double[4];
+            SafeNativeMethods.d_matrix_min_index(0, 3, 4, a, indices, values);
+            Assert.That(indices, Is.EqualTo(new[] { 1, 0, 0, 1 }));
+            Assert.That(values[0], Is.EqualTo(1.0));
+            Assert.That(values[1], Is.EqualTo(2.0));
+            Assert.That(values[2], Is.NaN);
+            Assert.That(values[3], Is.EqualTo(0.0));
+
+            indices = new int[3];
+            values = new double[3];
+            SafeNativeMethods.d_matrix_max_index(1, 3, 4, a, indices, values);
+            Assert.That(indices, Is.EqualTo(new[] { 1, 1, 3 }));
+            Assert.That(values, Is.EqualTo(new[] { 2.0, 2.0, 5.0 }));
+        }
+    }
+}
+
+#endif
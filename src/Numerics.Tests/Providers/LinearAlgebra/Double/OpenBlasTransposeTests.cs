@@ -0,0 +1,134 @@
+// <copyright file="OpenBlasTransposeTests.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// https://numerics.mathdotnet.com
+// https://github.com/mathnet/mathnet-numerics
+//
+// Copyright (c) 2009-2026 Math.NET
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+#if OPENBLAS
+
+using System;
+using MathNet.Numerics.Providers.LinearAlgebra;
+using MathNet.Numerics.Providers.OpenBLAS;
+using NUnit.Framework;
+using Complex = System.Numerics.Complex;
+
+namespace MathNet.Numerics.Tests.Providers.LinearAlgebra.Double
+{
+    /// <summary>
+    /// Tests of the cache-blocked scaled transpose of the OpenBLAS provider.
+    /// </summary>
+    [TestFixture, Category("LAProvider")]
+    public class OpenBlasTransposeTests
+    {
+        /// <summary>
+        /// Column-major rows x columns matrix with distinct entries.
+        /// </summary>
+        static double[] Sequence(int rows, int columns)
+        {
+            var a = new double[rows*columns];
+            for (int i = 0; i < a.Length; i++)
+            {
+                a[i] = i + 1;
+            }
+
+            return a;
+        }
+
+        /// <summary>
+        /// alpha * a^T for a column-major rows x columns matrix.
+        /// </summary>
+        static double[] Transposed(int rows, int columns, double alpha, double[] a)
+        {
+            var b = new double[a.Length];
+            for (int j = 0; j < columns; j++)
+            {
+                for (int i = 0; i < rows; i++)
+                {
+                    b[j + i*columns] = alpha*a[i + j*rows];
+                }
+            }
+
+            return b;
+        }
+
+        /// <summary>
+        /// Spans several 32x32 tiles with partial tiles on both edges and remainders of the 2x2 and 4x4 register blocks.
+        /// </summary>
+        [TestCase(1, 1)]
+        [TestCase(3, 5)]
+        [TestCase(37, 70)]
+        [TestCase(70, 37)]
+        [TestCase(64, 64)]
+        public void TransposeOutOfPlace(int rows, int columns)
+        {
+            var a = Sequence(rows, columns);
+            var b = new double[a.Length];
+            SafeNativeMethods.d_transpose(Transpose.Transpose, rows, columns, 2.0, a, b);
+            Assert.That(b, Is.EqualTo(Transposed(rows, columns, 2.0, a)));
+
+            var af = Array.ConvertAll(a, x => (float)x);
+            var bf = new float[a.Length];
+            SafeNativeMethods.s_transpose(Transpose.Transpose, rows, columns, 2.0f, af, bf);
+            Assert.That(bf, Is.EqualTo(Array.ConvertAll(Transposed(rows, columns, 2.0, a), x => (float)x)));
+        }
+
+        [TestCase(37, 70)]
+        [TestCase(70, 37)]
+        [TestCase(1, 9)]
+        [TestCase(65, 65)]
+        public void TransposeInPlace(int rows, int columns)
+        {
+            var a = Sequence(rows, columns);
+            var ab = (double[])a.Clone();
+            Assert.That(SafeNativeMethods.d_transpose_inplace(Transpose.Transpose, rows, columns, -1.5, ab), Is.EqualTo(0));
+            Assert.That(ab, Is.EqualTo(Transposed(rows, columns, -1.5, a)));
+        }
+
+        [TestCase(33, 34)]
+        [TestCase(40, 40)]
+        public void ConjugateTransposeInPlace(int rows, int columns)
+        {
+            var a = new Complex[rows*columns];
+            for (int i = 0; i < a.Length; i++)
+            {
+                a[i] = new Complex(i, -2*i);
+            }
+
+            var ab = (Complex[])a.Clone();
+            Assert.That(SafeNativeMethods.z_transpose_inplace(Transpose.ConjugateTranspose, rows, columns, new Complex(0, 1), ab), Is.EqualTo(0));
+
+            for (int j = 0; j < columns; j++)
+            {
+                for (int i = 0; i < rows; i++)
+                {
+                    Assert.That(ab[j + i*columns], Is.EqualTo(new Complex(0, 1)*Complex.Conjugate(a[i + j*rows])));
+                }
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,179 @@
+// <copyright file="OpenBlasRandomStreamTests.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// https://numerics.mathdotnet.com
+// https://github.com/mathnet/mathnet-numerics
+//
+// Copyright (c) 2009-2026 Math.NET
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+#if OPENBLAS
+
+using System;
+using MathNet.Numerics.Providers.OpenBLAS;
+using NUnit.Framework;
+
+namespace MathNet.Numerics.Tests.Providers.Random
+{
+    /// <summary>
+    /// Tests of the portable Philox4x32-10 streams of the OpenBLAS provider.
+    /// </summary>
+    [TestFixture, Category("Random")]
+    public class OpenBlasRandomStreamTests
+    {
+        const int Philox = 2;
+        const uint Seed = 42;
+
+        static IntPtr Create()
+        {
+            Assert.That(SafeNativeMethods.x_random_create(out IntPtr stream, Philox, 0, Seed), Is.EqualTo(0));
+            return stream;
+        }
+
+        static float[] Floats(IntPtr stream, int n)
+        {
+            var r = new float[n];
+            Assert.That(SafeNativeMethods.s_random_uniform(stream, n, 0.0f, 1.0f, r), Is.EqualTo(0));
+            return r;
+        }
+
+        /// <summary>
+        /// Each float consumes one 32-bit output, so skipping k must land where drawing k floats does,
+        /// whether the skip stays inside the buffered block of four outputs or crosses it.
+        /// </summary>
+        [TestCase(0, 0)]
+        [TestCase(0, 1)]
+        [TestCase(0, 3)]
+        [TestCase(0, 4)]
+        [TestCase(0, 5)]
+        [TestCase(1, 2)]
+        [TestCase(3, 1)]
+        [TestCase(2, 7)]
+        [TestCase(5, 1003)]
+        public void SkipAheadMatchesDrawing(int drawn, int skip)
+        {
+            var drawing = Create();
+            var skipping = Create();
+            try
+            {
+                Floats(drawing, drawn + skip);
+                Floats(skipping, drawn);
+                Assert.That(SafeNativeMethods.x_random_skip_ahead(skipping, skip), Is.EqualTo(0));
+
+                Assert.That(Floats(skipping, 9), Is.EqualTo(Floats(drawing, 9)));
+            }
+            finally
+            {
+                SafeNativeMethods.x_random_free(drawing);
+                SafeNativeMethods.x_random_free(skipping);
+            }
+        }
+
+        [Test]
+        public void SkipAheadIsAdditive()
+        {
+            const long skip = 1L << 34;
+
+            var once = Create();
+            var twice = Create();
+            try
+            {
+                Floats(once, 3);
+                Floats(twice, 3);
+                Assert.That(SafeNativeMethods.x_random_skip_ahead(once, 2*skip + 1), Is.EqualTo(0));
+                Assert.That(SafeNativeMethods.x_random_skip_ahead(twice, skip), Is.EqualTo(0));
+                Assert.That(SafeNativeMethods.x_random_skip_ahead(twice, skip + 1), Is.EqualTo(0));
+
+                Assert.That(Floats(twice, 9), Is.EqualTo(Floats(once, 9)));
+            }
+            finally
+            {
+                SafeNativeMethods.x_random_free(once);
+                SafeNativeMethods.x_random_free(twice);
+            }
+        }
+
+        [Test]
+        public void SkipAheadCountsTwoOutputsPerDouble()
+        {
+            var drawing = Create();
+            var skipping = Create();
+            try
+            {
+                var r = new double[11];
+                Assert.That(SafeNativeMethods.d_random_uniform(drawing, 11, 0.0, 1.0, r), Is.EqualTo(0));
+                Assert.That(SafeNativeMethods.x_random_skip_ahead(skipping, 2*11), Is.EqualTo(0));
+
+                var expected = new double[5];
+                var actual = new double[5];
+                SafeNativeMethods.d_random_uniform(drawing, 5, -1.0, 3.0, expected);
+                SafeNativeMethods.d_random_uniform(skipping, 5, -1.0, 3.0, actual);
+                Assert.That(actual, Is.EqualTo(expected));
+            }
+            finally
+            {
+                SafeNativeMethods.x_random_free(drawing);
+                SafeNativeMethods.x_random_free(skipping);
+            }
+        }
+
+        [Test]
+        public void CopyContinuesTheSameSequence()
+        {
+            var stream = Create();
+            try
+            {
+                Floats(stream, 5);
+                Assert.That(SafeNativeMethods.x_random_copy(out IntPtr copy, stream), Is.EqualTo(0));
+                try
+                {
+                    Assert.That(Floats(copy, 9), Is.EqualTo(Floats(stream, 9)));
+                }
+                finally
+                {
+                    SafeNativeMethods.x_random_free(copy);
+                }
+            }
+            finally
+            {
+                SafeNativeMethods.x_random_free(stream);
+            }
+        }
+
+        [Test]
+        public void NegativeSkipIsRejected()
+        {
+            var stream = Create();
+            try
+            {
+                Assert.That(SafeNativeMethods.x_random_skip_ahead(stream, -1), Is.EqualTo(-3));
+            }
+            finally
+            {
+                SafeNativeMethods.x_random_free(stream);
+            }
+        }
+    }
+}
+
+#endif
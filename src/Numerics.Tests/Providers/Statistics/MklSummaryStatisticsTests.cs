@@ -0,0 +1,153 @@
+// <copyright file="MklSummaryStatisticsTests.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// https://numerics.mathdotnet.com
+// https://github.com/mathnet/mathnet-numerics
+//
+// Copyright (c) 2009-2026 Math.NET
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+#if MKL
+
+using System;
+using MathNet.Numerics.Providers.MKL;
+using NUnit.Framework;
+
+namespace MathNet.Numerics.Tests.Providers.Statistics
+{
+    /// <summary>
+    /// Tests of the progressive summary statistics of the MKL provider: feeding the observations
+    /// block by block must give the same estimates as a single pass over all of them.
+    /// </summary>
+    [TestFixture, Category("LAProvider")]
+    public class MklSummaryStatisticsTests
+    {
+        // VSL_SS_* estimate flags of mkl_vsl_defines.h
+        const long Mean = 0x1;
+        const long CentralMoment2 = 0x10;
+        const long Min = 0x400;
+        const long Max = 0x800;
+        const long Covariance = 0x1000;
+        const long Estimates = Mean | CentralMoment2 | Min | Max | Covariance;
+
+        const int Dimension = 2;
+
+        // Two variables, observed 3 and then 4 times.
+        static readonly double[][] Columns1 = { new[] { 1.0, 2.0, 3.0 }, new[] { -4.0, 0.5, 2.0 } };
+        static readonly double[][] Columns2 = { new[] { 10.0, 20.0, -7.0, 4.0 }, new[] { 8.0, -1.0, 3.5, 6.0 } };
+
+        /// <summary>
+        /// Column-major n x p block, one observation per row.
+        /// </summary>
+        static double[] Block(params double[][][] parts)
+        {
+            int n = 0;
+            foreach (var part in parts)
+            {
+                n += part[0].Length;
+            }
+
+            var x = new double[n*Dimension];
+            int row = 0;
+            foreach (var part in parts)
+            {
+                for (int j = 0; j < Dimension; j++)
+                {
+                    Array.Copy(part[j], 0, x, j*n + row, part[j].Length);
+                }
+
+                row += part[0].Length;
+            }
+
+            return x;
+        }
+
+        [Test]
+        public void BlocksMatchSinglePass()
+        {
+            Assert.That(SafeNativeMethods.d_summary_statistics_create(out IntPtr blocks, Dimension, 0, Estimates, 0, null, 0.0), Is.EqualTo(0));
+            Assert.That(SafeNativeMethods.d_summary_statistics_create(out IntPtr single, Dimension, 0, Estimates, 0, null, 0.0), Is.EqualTo(0));
+            try
+            {
+                Assert.That(SafeNativeMethods.d_summary_statistics_update(blocks, 3, Block(Columns1)), Is.EqualTo(0));
+                Assert.That(SafeNativeMethods.d_summary_statistics_update(blocks, 4, Block(Columns2)), Is.EqualTo(0));
+                Assert.That(SafeNativeMethods.d_summary_statistics_update(single, 7, Block(Columns1, Columns2)), Is.EqualTo(0));
+
+                Assert.That(SafeNativeMethods.d_summary_statistics_count(blocks), Is.EqualTo(7.0));
+                Assert.That(SafeNativeMethods.d_summary_statistics_count(single), Is.EqualTo(7.0));
+
+                foreach (var estimate in new[] { Mean, CentralMoment2, Min, Max, Covariance })
+                {
+                    int size = estimate == Covariance ? Dimension*Dimension : Dimension;
+                    var expected = new double[size];
+                    var actual = new double[size];
+                    Assert.That(SafeNativeMethods.d_summary_statistics_get(single, estimate, expected), Is.EqualTo(0));
+                    Assert.That(SafeNativeMethods.d_summary_statistics_get(blocks, estimate, actual), Is.EqualTo(0));
+
+                    for (int i = 0; i < size; i++)
+                    {
+                        AssertHelpers.AlmostEqualRelative(expected[i], actual[i], 12);
+                    }
+                }
+            }
+            finally
+            {
+                SafeNativeMethods.x_summary_statistics_free(blocks);
+                SafeNativeMethods.x_summary_statistics_free(single);
+            }
+        }
+
+        [Test]
+        public void BlocksMatchSinglePassSingle()
+        {
+            Assert.That(SafeNativeMethods.s_summary_statistics_create(out IntPtr blocks, Dimension, 0, Mean | Min | Max, 0, null, 0.0f), Is.EqualTo(0));
+            try
+            {
+                var x1 = Array.ConvertAll(Block(Columns1), v => (float)v);
+                var x2 = Array.ConvertAll(Block(Columns2), v => (float)v);
+                Assert.That(SafeNativeMethods.s_summary_statistics_update(blocks, 3, x1), Is.EqualTo(0));
+                Assert.That(SafeNativeMethods.s_summary_statistics_update(blocks, 4, x2), Is.EqualTo(0));
+
+                Assert.That(SafeNativeMethods.s_summary_statistics_count(blocks), Is.EqualTo(7.0f));
+
+                var mean = new float[Dimension];
+                var min = new float[Dimension];
+                var max = new float[Dimension];
+                Assert.That(SafeNativeMethods.s_summary_statistics_get(blocks, Mean, mean), Is.EqualTo(0));
+                Assert.That(SafeNativeMethods.s_summary_statistics_get(blocks, Min, min), Is.EqualTo(0));
+                Assert.That(SafeNativeMethods.s_summary_statistics_get(blocks, Max, max), Is.EqualTo(0));
+
+                AssertHelpers.AlmostEqualRelative(33.0/7.0, mean[0], 5);
+                AssertHelpers.AlmostEqualRelative(15.0/7.0, mean[1], 5);
+                Assert.That(min, Is.EqualTo(new[] { -7.0f, -4.0f }));
+                Assert.That(max, Is.EqualTo(new[] { 20.0f, 8.0f }));
+            }
+            finally
+            {
+                SafeNativeMethods.x_summary_statistics_free(blocks);
+            }
+        }
+    }
+}
+
+#endif
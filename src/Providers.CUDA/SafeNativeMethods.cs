@@ -101,6 +101,12 @@ internal static class SafeNativeMethods
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
         internal static extern Complex z_dot_product(IntPtr blasHandle, int n, Complex[] x, Complex[] y);
 
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern Complex32 c_conjugate_dot_product(IntPtr blasHandle, int n, Complex32[] x, Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern Complex z_conjugate_dot_product(IntPtr blasHandle, int n, Complex[] x, Complex[] y);
+
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void s_matrix_multiply(IntPtr blasHandle, int transA, int transB, int m, int n, int k, float alpha, float[] x, float[] y, float beta, [In, Out] float[] c);
 
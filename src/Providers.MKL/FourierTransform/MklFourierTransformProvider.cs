@@ -29,7 +29,6 @@
 using System;
 using System.IO;
 using System.Security;
-using System.Threading;
 using MathNet.Numerics.Providers.FourierTransform;
 using Complex = System.Numerics.Complex;
 
@@ -39,17 +38,10 @@ internal sealed class MklFourierTransformProvider : IFourierTransformProvider, I
     {
         const int MinimumCompatibleRevision = 11;
 
-        class Kernel
-        {
-            public IntPtr Handle;
-            public int[] Dimensions;
-            public FourierTransformScaling Scaling;
-            public bool Real;
-            public bool Single;
-        }
+        // Descriptors are shared through the native descriptor cache (?_fft_cache_acquire), introduced in Fourier transform v1.4.
+        const int MinimumCompatibleMinor = 4;
 
         readonly string _hintPath;
-        Kernel _kernel;
 
         /// <param name="hintPath">Hint path where to look for the native binaries</param>
         internal MklFourierTransformProvider(string hintPath)
@@ -81,9 +73,9 @@ public void InitializeVerify()
             // we only support exactly one major version, since major version changes imply a breaking change.
             int fftMajor = SafeNativeMethods.query_capability((int) ProviderCapability.FourierTransformMajor);
             int fftMinor = SafeNativeMethods.query_capability((int) ProviderCapability.FourierTransformMinor);
-            if (!(fftMajor == 1 && fftMinor >= 0))
+            if (!(fftMajor == 1 && fftMinor >= MinimumCompatibleMinor))
             {
-                throw new NotSupportedException(FormattableString.Invariant($"MKL Native Provider not compatible. Expecting Fourier transform v1 but provider implements v{fftMajor}."));
+                throw new NotSupportedException(FormattableString.Invariant($"MKL Native Provider not compatible. Expecting Fourier transform v1.{MinimumCompatibleMinor} or newer v1 but provider implements v{fftMajor}.{fftMinor}."));
             }
         }
 
@@ -94,12 +86,7 @@ public void InitializeVerify()
         [SecuritySafeCritical]
         public void FreeResources()
         {
-            Kernel kernel = Interlocked.Exchange(ref _kernel, null);
-            if (kernel != null)
-            {
-                SafeNativeMethods.x_fft_free(ref kernel.Handle);
-            }
-
+            SafeNativeMethods.x_fft_cache_clear();
             MklProvider.FreeResources();
         }
 
@@ -108,204 +95,154 @@ public override string ToString()
             return MklProvider.Describe();
         }
 
+        /// <summary>
+        /// Acquires a committed in-place descriptor from the native cache; hand it back with <see cref="Release"/>.
+        /// </summary>
         [SecuritySafeCritical]
-        Kernel Configure(int length, FourierTransformScaling scaling, bool real, bool single)
+        static IntPtr Acquire(int length, FourierTransformScaling scaling, bool real, bool single)
         {
-            Kernel kernel = Interlocked.Exchange(ref _kernel, null);
-
-            if (kernel == null)
-            {
-                kernel = new Kernel
-                {
-                    Dimensions = new[] {length},
-                    Scaling = scaling,
-                    Real = real,
-                    Single = single
-                };
-
-                if (single)
-                {
-                    if (real) SafeNativeMethods.s_fft_create(out kernel.Handle, length, (float)ForwardScaling(scaling, length), (float)BackwardScaling(scaling, length));
-                    else SafeNativeMethods.c_fft_create(out kernel.Handle, length, (float)ForwardScaling(scaling, length), (float)BackwardScaling(scaling, length));
-                }
-                else
-                {
-                    if (real) SafeNativeMethods.d_fft_create(out kernel.Handle, length, ForwardScaling(scaling, length), BackwardScaling(scaling, length));
-                    else SafeNativeMethods.z_fft_create(out kernel.Handle, length, ForwardScaling(scaling, length), BackwardScaling(scaling, length));
-                }
-
-                return kernel;
-            }
-
-            if (kernel.Dimensions.Length != 1 || kernel.Dimensions[0] != length || kernel.Scaling != scaling || kernel.Real != real || kernel.Single != single)
-            {
-                SafeNativeMethods.x_fft_free(ref kernel.Handle);
-
-                if (single)
-                {
-                    if (real) SafeNativeMethods.s_fft_create(out kernel.Handle, length, (float)ForwardScaling(scaling, length), (float)BackwardScaling(scaling, length));
-                    else SafeNativeMethods.c_fft_create(out kernel.Handle, length, (float)ForwardScaling(scaling, length), (float)BackwardScaling(scaling, length));
-                }
-                else
-                {
-                    if (real) SafeNativeMethods.d_fft_create(out kernel.Handle, length, ForwardScaling(scaling, length), BackwardScaling(scaling, length));
-                    else SafeNativeMethods.z_fft_create(out kernel.Handle, length, ForwardScaling(scaling, length), BackwardScaling(scaling, length));
-                }
-
-                kernel.Dimensions = new[] {length};
-                kernel.Scaling = scaling;
-                kernel.Real = real;
-                kernel.Single = single;
-                return kernel;
-            }
-
-            return kernel;
+            return Acquire(new[] {length}, scaling, real, single);
         }
 
         [SecuritySafeCritical]
-        Kernel Configure(int[] dimensions, FourierTransformScaling scaling, bool single)
+        static IntPtr Acquire(int[] dimensions, FourierTransformScaling scaling, bool real, bool single)
         {
-            if (dimensions.Length == 1)
-            {
-                return Configure(dimensions[0], scaling, false, single);
-            }
-
-            Kernel kernel = Interlocked.Exchange(ref _kernel, null);
-
-            if (kernel == null)
+            long length = 1;
+            for (int i = 0; i < dimensions.Length; i++)
             {
-                kernel = new Kernel
-                {
-                    Dimensions = dimensions,
-                    Scaling = scaling,
-                    Real = false,
-                    Single = single
-                };
-
-                long length = 1;
-                for (int i = 0; i < dimensions.Length; i++)
-                {
-                    length *= dimensions[i];
-                }
-
-                if (single)
-                {
-                    SafeNativeMethods.c_fft_create_multidim(out kernel.Handle, dimensions.Length, dimensions, (float)ForwardScaling(scaling, length), (float)BackwardScaling(scaling, length));
-                }
-                else
-                {
-                    SafeNativeMethods.z_fft_create_multidim(out kernel.Handle, dimensions.Length, dimensions, ForwardScaling(scaling, length), BackwardScaling(scaling, length));
-                }
-
-                return kernel;
+                length *= dimensions[i];
             }
 
-            bool mismatch = kernel.Dimensions.Length != dimensions.Length || kernel.Scaling != scaling || kernel.Real != false || kernel.Single != single;
-            if (!mismatch)
+            IntPtr handle;
+            int status;
+            if (single)
             {
-                for (int i = 0; i < dimensions.Length; i++)
-                {
-                    if (dimensions[i] != kernel.Dimensions[i])
-                    {
-                        mismatch = true;
-                        break;
-                    }
-                }
+                if (real) status = SafeNativeMethods.s_fft_cache_acquire(out handle, dimensions.Length, dimensions, (float)ForwardScaling(scaling, length), (float)BackwardScaling(scaling, length), 1);
+                else status = SafeNativeMethods.c_fft_cache_acquire(out handle, dimensions.Length, dimensions, (float)ForwardScaling(scaling, length), (float)BackwardScaling(scaling, length), 1);
             }
-
-            if (mismatch)
+            else
             {
-                long length = 1;
-                for (int i = 0; i < dimensions.Length; i++)
-                {
-                    length *= dimensions[i];
-                }
-
-                SafeNativeMethods.x_fft_free(ref kernel.Handle);
-
-                if (single)
-                {
-                    SafeNativeMethods.c_fft_create_multidim(out kernel.Handle, dimensions.Length, dimensions, (float)ForwardScaling(scaling, length), (float)BackwardScaling(scaling, length));
-                }
-                else
-                {
-                    SafeNativeMethods.z_fft_create_multidim(out kernel.Handle, dimensions.Length, dimensions, ForwardScaling(scaling, length), BackwardScaling(scaling, length));
-                }
-
-                kernel.Dimensions = dimensions;
-                kernel.Scaling = scaling;
-                kernel.Real = false;
-                kernel.Single = single;
-                return kernel;
+                if (real) status = SafeNativeMethods.d_fft_cache_acquire(out handle, dimensions.Length, dimensions, ForwardScaling(scaling, length), BackwardScaling(scaling, length), 1);
+                else status = SafeNativeMethods.z_fft_cache_acquire(out handle, dimensions.Length, dimensions, ForwardScaling(scaling, length), BackwardScaling(scaling, length), 1);
             }
 
-            return kernel;
+            ThrowOnError(status);
+            return handle;
         }
 
         [SecuritySafeCritical]
-        void Release(Kernel kernel)
+        static void Release(IntPtr handle)
         {
-            Kernel existing = Interlocked.Exchange(ref _kernel, kernel);
-            if (existing != null)
+            SafeNativeMethods.x_fft_cache_release(handle);
+        }
+
+        /// <summary>
+        /// Surfaces a non-zero DFTI status of the native provider.
+        /// </summary>
+        static void ThrowOnError(int status)
+        {
+            if (status != 0)
             {
-                SafeNativeMethods.x_fft_free(ref existing.Handle);
+                throw new InvalidOperationException(FormattableString.Invariant($"MKL Native Provider Fourier transform failed with DFTI status {status}."));
             }
         }
 
         [SecuritySafeCritical]
         public void Forward(Complex32[] samples, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(samples.Length, scaling, false, true);
-            SafeNativeMethods.c_fft_forward(kernel.Handle, samples);
-            Release(kernel);
+            IntPtr handle = Acquire(samples.Length, scaling, false, true);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.c_fft_forward(handle, samples));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         [SecuritySafeCritical]
         public void Forward(Complex[] samples, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(samples.Length, scaling, false, false);
-            SafeNativeMethods.z_fft_forward(kernel.Handle, samples);
-            Release(kernel);
+            IntPtr handle = Acquire(samples.Length, scaling, false, false);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.z_fft_forward(handle, samples));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         [SecuritySafeCritical]
         public void Backward(Complex32[] spectrum, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(spectrum.Length, scaling, false, true);
-            SafeNativeMethods.c_fft_backward(kernel.Handle, spectrum);
-            Release(kernel);
+            IntPtr handle = Acquire(spectrum.Length, scaling, false, true);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.c_fft_backward(handle, spectrum));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         [SecuritySafeCritical]
         public void Backward(Complex[] spectrum, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(spectrum.Length, scaling, false, false);
-            SafeNativeMethods.z_fft_backward(kernel.Handle, spectrum);
-            Release(kernel);
+            IntPtr handle = Acquire(spectrum.Length, scaling, false, false);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.z_fft_backward(handle, spectrum));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         [SecuritySafeCritical]
         public void ForwardReal(float[] samples, int n, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(n, scaling, true, true);
-            SafeNativeMethods.s_fft_forward(kernel.Handle, samples);
-            Release(kernel);
+            IntPtr handle = Acquire(n, scaling, true, true);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.s_fft_forward(handle, samples));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         [SecuritySafeCritical]
         public void ForwardReal(double[] samples, int n, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(n, scaling, true, false);
-            SafeNativeMethods.d_fft_forward(kernel.Handle, samples);
-            Release(kernel);
+            IntPtr handle = Acquire(n, scaling, true, false);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.d_fft_forward(handle, samples));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         [SecuritySafeCritical]
         public void BackwardReal(float[] spectrum, int n, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(n, scaling, true, true);
-            SafeNativeMethods.s_fft_backward(kernel.Handle, spectrum);
-            Release(kernel);
+            IntPtr handle = Acquire(n, scaling, true, true);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.s_fft_backward(handle, spectrum));
+            }
+            finally
+            {
+                Release(handle);
+            }
 
             spectrum[n] = 0f;
         }
@@ -313,9 +250,15 @@ public void BackwardReal(float[] spectrum, int n, FourierTransformScaling scalin
         [SecuritySafeCritical]
         public void BackwardReal(double[] spectrum, int n, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(n, scaling, true, false);
-            SafeNativeMethods.d_fft_backward(kernel.Handle, spectrum);
-            Release(kernel);
+            IntPtr handle = Acquire(n, scaling, true, false);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.d_fft_backward(handle, spectrum));
+            }
+            finally
+            {
+                Release(handle);
+            }
 
             spectrum[n] = 0d;
         }
@@ -323,33 +266,57 @@ public void BackwardReal(double[] spectrum, int n, FourierTransformScaling scali
         [SecuritySafeCritical]
         public void ForwardMultidim(Complex32[] samples, int[] dimensions, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(dimensions, scaling, true);
-            SafeNativeMethods.c_fft_forward(kernel.Handle, samples);
-            Release(kernel);
+            IntPtr handle = Acquire(dimensions, scaling, false, true);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.c_fft_forward(handle, samples));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         [SecuritySafeCritical]
         public void ForwardMultidim(Complex[] samples, int[] dimensions, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(dimensions, scaling, false);
-            SafeNativeMethods.z_fft_forward(kernel.Handle, samples);
-            Release(kernel);
+            IntPtr handle = Acquire(dimensions, scaling, false, false);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.z_fft_forward(handle, samples));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         [SecuritySafeCritical]
         public void BackwardMultidim(Complex32[] spectrum, int[] dimensions, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(dimensions, scaling, true);
-            SafeNativeMethods.c_fft_backward(kernel.Handle, spectrum);
-            Release(kernel);
+            IntPtr handle = Acquire(dimensions, scaling, false, true);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.c_fft_backward(handle, spectrum));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         [SecuritySafeCritical]
         public void BackwardMultidim(Complex[] spectrum, int[] dimensions, FourierTransformScaling scaling)
         {
-            Kernel kernel = Configure(dimensions, scaling, false);
-            SafeNativeMethods.z_fft_backward(kernel.Handle, spectrum);
-            Release(kernel);
+            IntPtr handle = Acquire(dimensions, scaling, false, false);
+            try
+            {
+                ThrowOnError(SafeNativeMethods.z_fft_backward(handle, spectrum));
+            }
+            finally
+            {
+                Release(handle);
+            }
         }
 
         static double ForwardScaling(FourierTransformScaling scaling, long length)
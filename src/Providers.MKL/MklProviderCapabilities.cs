@@ -38,6 +38,7 @@ internal enum ProviderPlatform : int
 
     internal enum ProviderConfig : int
     {
+        IntegerSize = 5,
         MklMajorVersion = 32,
         MklMinorVersion = 33,
         MklUpdateVersion = 34,
@@ -57,5 +58,15 @@ internal enum ProviderCapability : int
         FourierTransformMinor = 385,
         SparseSolverMajor = 512,
         SparseSolverMinor = 513,
+        SparseBlasMajor = 514,
+        SparseBlasMinor = 515,
+        SummaryStatisticsMajor = 640,
+        SummaryStatisticsMinor = 641,
+        RandomNumbersMajor = 642,
+        RandomNumbersMinor = 643,
+        ConvolutionMajor = 644,
+        ConvolutionMinor = 645,
+        SplinesMajor = 646,
+        SplinesMinor = 647,
     }
 }
@@ -51,7 +51,8 @@ public enum MklConsistency
     public enum MklAccuracy : uint
     {
         Low = 0x1,
-        High = 0x2
+        High = 0x2,
+        EnhancedPerformance = 0x3
     }
 
     public enum MklPrecision : uint
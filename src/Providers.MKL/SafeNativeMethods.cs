@@ -116,6 +116,12 @@ internal static class SafeNativeMethods
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
         internal static extern Complex z_dot_product(int n, Complex[] x, Complex[] y);
 
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern Complex32 c_conjugate_dot_product(int n, Complex32[] x, Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern Complex z_conjugate_dot_product(int n, Complex[] x, Complex[] y);
+
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void s_matrix_multiply(Transpose transA, Transpose transB, int m, int n, int k, float alpha, float[] x, float[] y, float beta, [In, Out] float[] c);
 
@@ -128,6 +134,330 @@ internal static class SafeNativeMethods
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void z_matrix_multiply(Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, Complex[] x, Complex[] y, Complex beta, [In, Out] Complex[] c);
 
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_view(Transpose transA, Transpose transB, int m, int n, int k, float alpha, float[] x, IntPtr xOffset, int lda, float[] y, IntPtr yOffset, int ldb, float beta, [In, Out] float[] c, IntPtr cOffset, int ldc);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_view(Transpose transA, Transpose transB, int m, int n, int k, double alpha, double[] x, IntPtr xOffset, int lda, double[] y, IntPtr yOffset, int ldb, double beta, [In, Out] double[] c, IntPtr cOffset, int ldc);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_view(Transpose transA, Transpose transB, int m, int n, int k, Complex32 alpha, Complex32[] x, IntPtr xOffset, int lda, Complex32[] y, IntPtr yOffset, int ldb, Complex32 beta, [In, Out] Complex32[] c, IntPtr cOffset, int ldc);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_view(Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, Complex[] x, IntPtr xOffset, int lda, Complex[] y, IntPtr yOffset, int ldb, Complex beta, [In, Out] Complex[] c, IntPtr cOffset, int ldc);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_batch(Transpose transA, Transpose transB, int m, int n, int k, float alpha, IntPtr[] x, IntPtr[] y, float beta, IntPtr[] c, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_batch(Transpose transA, Transpose transB, int m, int n, int k, double alpha, IntPtr[] x, IntPtr[] y, double beta, IntPtr[] c, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_batch(Transpose transA, Transpose transB, int m, int n, int k, Complex32 alpha, IntPtr[] x, IntPtr[] y, Complex32 beta, IntPtr[] c, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_batch(Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, IntPtr[] x, IntPtr[] y, Complex beta, IntPtr[] c, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_batch_strided(Transpose transA, Transpose transB, int m, int n, int k, float alpha, float[] x, int xStride, float[] y, int yStride, float beta, [In, Out] float[] c, int cStride, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_batch_strided(Transpose transA, Transpose transB, int m, int n, int k, double alpha, double[] x, int xStride, double[] y, int yStride, double beta, [In, Out] double[] c, int cStride, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_batch_strided(Transpose transA, Transpose transB, int m, int n, int k, Complex32 alpha, Complex32[] x, int xStride, Complex32[] y, int yStride, Complex32 beta, [In, Out] Complex32[] c, int cStride, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_batch_strided(Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, Complex[] x, int xStride, Complex[] y, int yStride, Complex beta, [In, Out] Complex[] c, int cStride, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_vector_multiply(Transpose trans, int m, int n, float alpha, float[] a, float[] x, float beta, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_vector_multiply(Transpose trans, int m, int n, double alpha, double[] a, double[] x, double beta, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_vector_multiply(Transpose trans, int m, int n, Complex32 alpha, Complex32[] a, Complex32[] x, Complex32 beta, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_vector_multiply(Transpose trans, int m, int n, Complex alpha, Complex[] a, Complex[] x, Complex beta, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_symmetric_matrix_vector_multiply(int uplo, int n, float alpha, float[] a, float[] x, float beta, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_symmetric_matrix_vector_multiply(int uplo, int n, double alpha, double[] a, double[] x, double beta, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_hermitian_matrix_vector_multiply(int uplo, int n, Complex32 alpha, Complex32[] a, Complex32[] x, Complex32 beta, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_hermitian_matrix_vector_multiply(int uplo, int n, Complex alpha, Complex[] a, Complex[] x, Complex beta, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_triangular_matrix_vector_multiply(int uplo, Transpose trans, int diag, int n, float[] a, [In, Out] float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_triangular_matrix_vector_multiply(int uplo, Transpose trans, int diag, int n, double[] a, [In, Out] double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_triangular_matrix_vector_multiply(int uplo, Transpose trans, int diag, int n, Complex32[] a, [In, Out] Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_triangular_matrix_vector_multiply(int uplo, Transpose trans, int diag, int n, Complex[] a, [In, Out] Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_triangular_matrix_vector_solve(int uplo, Transpose trans, int diag, int n, float[] a, [In, Out] float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_triangular_matrix_vector_solve(int uplo, Transpose trans, int diag, int n, double[] a, [In, Out] double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_triangular_matrix_vector_solve(int uplo, Transpose trans, int diag, int n, Complex32[] a, [In, Out] Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_triangular_matrix_vector_solve(int uplo, Transpose trans, int diag, int n, Complex[] a, [In, Out] Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_rank_one_update(int m, int n, float alpha, float[] x, float[] y, [In, Out] float[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_rank_one_update(int m, int n, double alpha, double[] x, double[] y, [In, Out] double[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_rank_one_update(int m, int n, Complex32 alpha, Complex32[] x, Complex32[] y, [In, Out] Complex32[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_rank_one_update(int m, int n, Complex alpha, Complex[] x, Complex[] y, [In, Out] Complex[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_conjugate_rank_one_update(int m, int n, Complex32 alpha, Complex32[] x, Complex32[] y, [In, Out] Complex32[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_conjugate_rank_one_update(int m, int n, Complex alpha, Complex[] x, Complex[] y, [In, Out] Complex[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_symmetric_rank_k_update(int uplo, Transpose trans, int n, int k, float alpha, float[] a, float beta, [In, Out] float[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_symmetric_rank_k_update(int uplo, Transpose trans, int n, int k, double alpha, double[] a, double beta, [In, Out] double[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_hermitian_rank_k_update(int uplo, Transpose trans, int n, int k, float alpha, Complex32[] a, float beta, [In, Out] Complex32[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_hermitian_rank_k_update(int uplo, Transpose trans, int n, int k, double alpha, Complex[] a, double beta, [In, Out] Complex[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_triangle(int uplo, Transpose transA, Transpose transB, int n, int k, float alpha, float[] x, float[] y, float beta, [In, Out] float[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_triangle(int uplo, Transpose transA, Transpose transB, int n, int k, double alpha, double[] x, double[] y, double beta, [In, Out] double[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_triangle(int uplo, Transpose transA, Transpose transB, int n, int k, Complex32 alpha, Complex32[] x, Complex32[] y, Complex32 beta, [In, Out] Complex32[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_triangle(int uplo, Transpose transA, Transpose transB, int n, int k, Complex alpha, Complex[] x, Complex[] y, Complex beta, [In, Out] Complex[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_triangular_solve(int side, int uplo, Transpose trans, int diag, int m, int n, float alpha, float[] a, [In, Out] float[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_triangular_solve(int side, int uplo, Transpose trans, int diag, int m, int n, double alpha, double[] a, [In, Out] double[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_triangular_solve(int side, int uplo, Transpose trans, int diag, int m, int n, Complex32 alpha, Complex32[] a, [In, Out] Complex32[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_triangular_solve(int side, int uplo, Transpose trans, int diag, int m, int n, Complex alpha, Complex[] a, [In, Out] Complex[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_triangular_multiply(int side, int uplo, Transpose trans, int diag, int m, int n, float alpha, float[] a, [In, Out] float[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_triangular_multiply(int side, int uplo, Transpose trans, int diag, int m, int n, double alpha, double[] a, [In, Out] double[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_triangular_multiply(int side, int uplo, Transpose trans, int diag, int m, int n, Complex32 alpha, Complex32[] a, [In, Out] Complex32[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_triangular_multiply(int side, int uplo, Transpose trans, int diag, int m, int n, Complex alpha, Complex[] a, [In, Out] Complex[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_matrix_multiply_kernel_create([Out] out IntPtr handle, Transpose transA, Transpose transB, int m, int n, int k, float alpha, float beta);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_matrix_multiply_kernel_create([Out] out IntPtr handle, Transpose transA, Transpose transB, int m, int n, int k, double alpha, double beta);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_matrix_multiply_kernel_create([Out] out IntPtr handle, Transpose transA, Transpose transB, int m, int n, int k, Complex32 alpha, Complex32 beta);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_matrix_multiply_kernel_create([Out] out IntPtr handle, Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, Complex beta);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_kernel_execute([In] IntPtr handle, float[] x, float[] y, [In, Out] float[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_kernel_execute([In] IntPtr handle, double[] x, double[] y, [In, Out] double[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_kernel_execute([In] IntPtr handle, Complex32[] x, Complex32[] y, [In, Out] Complex32[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_kernel_execute([In] IntPtr handle, Complex[] x, Complex[] y, [In, Out] Complex[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_matrix_multiply_kernel_free([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float s_vector_norm(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double d_vector_norm(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float c_vector_norm(int n, Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double z_vector_norm(int n, Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float s_absolute_sum(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double d_absolute_sum(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float c_absolute_sum(int n, Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double z_absolute_sum(int n, Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_max_abs_index(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_max_abs_index(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_max_abs_index(int n, Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_max_abs_index(int n, Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_min_abs_index(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_min_abs_index(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_min_abs_index(int n, Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_min_abs_index(int n, Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_axpby(int n, float alpha, float[] x, float beta, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_axpby(int n, double alpha, double[] x, double beta, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_axpby(int n, Complex32 alpha, Complex32[] x, Complex32 beta, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_axpby(int n, Complex alpha, Complex[] x, Complex beta, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_rotate(int n, [In, Out] float[] x, [In, Out] float[] y, float c, float s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_rotate(int n, [In, Out] double[] x, [In, Out] double[] y, double c, double s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_rotate(int n, [In, Out] Complex32[] x, [In, Out] Complex32[] y, float c, float s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_rotate(int n, [In, Out] Complex[] x, [In, Out] Complex[] y, double c, double s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_rotate_generate(ref float a, ref float b, out float c, out float s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_rotate_generate(ref double a, ref double b, out double c, out double s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_rotate_generate(ref Complex32 a, ref Complex32 b, out float c, out Complex32 s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_rotate_generate(ref Complex a, ref Complex b, out double c, out Complex s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_swap(int n, [In, Out] float[] x, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_swap(int n, [In, Out] double[] x, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_swap(int n, [In, Out] Complex32[] x, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_swap(int n, [In, Out] Complex[] x, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_copy(int n, float[] x, [Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_copy(int n, double[] x, [Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_copy(int n, Complex32[] x, [Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_copy(int n, Complex[] x, [Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_matrix_multiply_pack([Out] out IntPtr handle, Transpose transA, int m, int k, float alpha, float[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_matrix_multiply_pack([Out] out IntPtr handle, Transpose transA, int m, int k, double alpha, double[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_packed([In] IntPtr handle, Transpose transB, int n, float[] y, float beta, [In, Out] float[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_packed([In] IntPtr handle, Transpose transB, int n, double[] y, double beta, [In, Out] double[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_matrix_multiply_pack_free([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_transpose(Transpose trans, int rows, int cols, float alpha, float[] a, [Out] float[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_transpose(Transpose trans, int rows, int cols, double alpha, double[] a, [Out] double[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_transpose(Transpose trans, int rows, int cols, Complex32 alpha, Complex32[] a, [Out] Complex32[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_transpose(Transpose trans, int rows, int cols, Complex alpha, Complex[] a, [Out] Complex[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_transpose_inplace(Transpose trans, int rows, int cols, float alpha, [In, Out] float[] ab);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_transpose_inplace(Transpose trans, int rows, int cols, double alpha, [In, Out] double[] ab);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_transpose_inplace(Transpose trans, int rows, int cols, Complex32 alpha, [In, Out] Complex32[] ab);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_transpose_inplace(Transpose trans, int rows, int cols, Complex alpha, [In, Out] Complex[] ab);
+
         #endregion BLAS
 
         #region LAPACK
@@ -376,80 +706,973 @@ internal static class SafeNativeMethods
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void z_vector_power(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result);
 
-        #endregion  Vector Functions
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_exp(int n, float[] x, [In, Out] float[] result);
 
-        #region FFT
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_log(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int x_fft_free([In] ref IntPtr handle);
+        internal static extern void s_vector_sqrt(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int z_fft_create([Out] out IntPtr handle, int n, double forward_scale, double backward_scale);
+        internal static extern void s_vector_inverse_sqrt(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int c_fft_create([Out] out IntPtr handle, int n, float forward_scale, float backward_scale);
+        internal static extern void s_vector_sin(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int d_fft_create([Out] out IntPtr handle, int n, double forward_scale, double backward_scale);
+        internal static extern void s_vector_cos(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int s_fft_create([Out] out IntPtr handle, int n, float forward_scale, float backward_scale);
+        internal static extern void s_vector_tanh(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int z_fft_create_multidim([Out] out IntPtr handle, int dimensions, [In] int[] n, double forward_scale, double backward_scale);
+        internal static extern void s_vector_erf(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int c_fft_create_multidim([Out] out IntPtr handle, int dimensions, [In] int[] n, float forward_scale, float backward_scale);
+        internal static extern void s_vector_erf_inverse(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int z_fft_forward([In] IntPtr handle, [In, Out] Complex[] x);
+        internal static extern void s_vector_cdf_normal(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int c_fft_forward([In] IntPtr handle, [In, Out] Complex32[] x);
+        internal static extern void s_vector_log_gamma(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int d_fft_forward([In] IntPtr handle, [In, Out] double[] x);
+        internal static extern void s_vector_inverse(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int s_fft_forward([In] IntPtr handle, [In, Out] float[] x);
+        internal static extern void s_vector_sin_cos(int n, float[] x, [In, Out] float[] sin, [In, Out] float[] cos);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int z_fft_backward([In] IntPtr handle, [In, Out] Complex[] x);
+        internal static extern void s_vector_abs(int n, float[] x, [In, Out] float[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int c_fft_backward([In] IntPtr handle, [In, Out] Complex32[] x);
+        internal static extern void d_vector_exp(int n, double[] x, [In, Out] double[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int d_fft_backward([In] IntPtr handle, [In, Out] double[] x);
+        internal static extern void d_vector_log(int n, double[] x, [In, Out] double[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int s_fft_backward([In] IntPtr handle, [In, Out] float[] x);
+        internal static extern void d_vector_sqrt(int n, double[] x, [In, Out] double[] result);
 
-        #endregion FFT
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_inverse_sqrt(int n, double[] x, [In, Out] double[] result);
 
-        #region Direct Sparse Solver
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_sin(int n, double[] x, [In, Out] double[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int s_dss_solve(int matrixStructure, int matrixType, int systemType,
-            int rowCount, int columnCount, int nonZerosCount, int[] rowPointers, int[] columnIndices, float[] values,
-            int nRhs, [In, Out] float[] rhs, [In, Out] float[] solution);
+        internal static extern void d_vector_cos(int n, double[] x, [In, Out] double[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int d_dss_solve(int matrixStructure, int matrixType, int systemType,
-            int rowCount, int columnCount, int nonZerosCount, int[] rowPointers, int[] columnIndices, double[] values,
-            int nRhs, [In, Out] double[] rhs, [In, Out] double[] solution);
+        internal static extern void d_vector_tanh(int n, double[] x, [In, Out] double[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int c_dss_solve(int matrixStructure, int matrixType, int systemType,
-            int rowCount, int columnCount, int nonZerosCount, int[] rowPointers, int[] columnIndices, Complex32[] values,
-            int nRhs, [In, Out] Complex32[] rhs, [In, Out] Complex32[] solution);
+        internal static extern void d_vector_erf(int n, double[] x, [In, Out] double[] result);
 
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int z_dss_solve(int matrixStructure, int matrixType, int systemType,
-            int rowCount, int columnCount, int nonZerosCount, int[] rowPointers, int[] columnIndices, Complex[] values,
-            int nRhs, [In, Out] Complex[] rhs, [In, Out] Complex[] solution);
+        internal static extern void d_vector_erf_inverse(int n, double[] x, [In, Out] double[] result);
 
-        #endregion Direct Sparse Solver
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_cdf_normal(int n, double[] x, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_log_gamma(int n, double[] x, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_inverse(int n, double[] x, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_sin_cos(int n, double[] x, [In, Out] double[] sin, [In, Out] double[] cos);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_abs(int n, double[] x, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_exp(int n, Complex32[] x, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_log(int n, Complex32[] x, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_sqrt(int n, Complex32[] x, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_sin(int n, Complex32[] x, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_cos(int n, Complex32[] x, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_tanh(int n, Complex32[] x, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_abs(int n, Complex32[] x, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_exp(int n, Complex[] x, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_log(int n, Complex[] x, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_sqrt(int n, Complex[] x, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_sin(int n, Complex[] x, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_cos(int n, Complex[] x, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_tanh(int n, Complex[] x, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_abs(int n, Complex[] x, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_add_mode(int n, float[] x, float[] y, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_subtract_mode(int n, float[] x, float[] y, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_multiply_mode(int n, float[] x, float[] y, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_divide_mode(int n, float[] x, float[] y, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_power_mode(int n, float[] x, float[] y, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_add_mode(int n, double[] x, double[] y, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_subtract_mode(int n, double[] x, double[] y, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_multiply_mode(int n, double[] x, double[] y, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_divide_mode(int n, double[] x, double[] y, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_power_mode(int n, double[] x, double[] y, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_add_mode(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_subtract_mode(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_multiply_mode(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_divide_mode(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_power_mode(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_add_mode(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_subtract_mode(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_multiply_mode(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_divide_mode(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_power_mode(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_exp_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_log_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_sqrt_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_inverse_sqrt_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_sin_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_cos_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_tanh_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_erf_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_erf_inverse_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_cdf_normal_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_log_gamma_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_inverse_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_sin_cos_mode(int n, float[] x, [In, Out] float[] sin, [In, Out] float[] cos, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_abs_mode(int n, float[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_exp_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_log_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_sqrt_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_inverse_sqrt_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_sin_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_cos_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_tanh_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_erf_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_erf_inverse_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_cdf_normal_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_log_gamma_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_inverse_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_sin_cos_mode(int n, double[] x, [In, Out] double[] sin, [In, Out] double[] cos, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_abs_mode(int n, double[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_exp_mode(int n, Complex32[] x, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_log_mode(int n, Complex32[] x, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_sqrt_mode(int n, Complex32[] x, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_sin_mode(int n, Complex32[] x, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_cos_mode(int n, Complex32[] x, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_tanh_mode(int n, Complex32[] x, [In, Out] Complex32[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_abs_mode(int n, Complex32[] x, [In, Out] float[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_exp_mode(int n, Complex[] x, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_log_mode(int n, Complex[] x, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_sqrt_mode(int n, Complex[] x, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_sin_mode(int n, Complex[] x, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_cos_mode(int n, Complex[] x, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_tanh_mode(int n, Complex[] x, [In, Out] Complex[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_abs_mode(int n, Complex[] x, [In, Out] double[] result, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_add_strided(int n, float[] x, int incx, float[] y, int incy, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_subtract_strided(int n, float[] x, int incx, float[] y, int incy, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_multiply_strided(int n, float[] x, int incx, float[] y, int incy, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_divide_strided(int n, float[] x, int incx, float[] y, int incy, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_power_strided(int n, float[] x, int incx, float[] y, int incy, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_add_strided(int n, double[] x, int incx, double[] y, int incy, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_subtract_strided(int n, double[] x, int incx, double[] y, int incy, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_multiply_strided(int n, double[] x, int incx, double[] y, int incy, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_divide_strided(int n, double[] x, int incx, double[] y, int incy, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_power_strided(int n, double[] x, int incx, double[] y, int incy, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_add_strided(int n, Complex32[] x, int incx, Complex32[] y, int incy, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_subtract_strided(int n, Complex32[] x, int incx, Complex32[] y, int incy, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_multiply_strided(int n, Complex32[] x, int incx, Complex32[] y, int incy, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_divide_strided(int n, Complex32[] x, int incx, Complex32[] y, int incy, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_power_strided(int n, Complex32[] x, int incx, Complex32[] y, int incy, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_add_strided(int n, Complex[] x, int incx, Complex[] y, int incy, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_subtract_strided(int n, Complex[] x, int incx, Complex[] y, int incy, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_multiply_strided(int n, Complex[] x, int incx, Complex[] y, int incy, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_divide_strided(int n, Complex[] x, int incx, Complex[] y, int incy, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_power_strided(int n, Complex[] x, int incx, Complex[] y, int incy, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_exp_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_log_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_sqrt_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_inverse_sqrt_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_sin_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_cos_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_tanh_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_erf_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_erf_inverse_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_cdf_normal_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_log_gamma_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_inverse_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_sin_cos_strided(int n, float[] x, int incx, [In, Out] float[] sin, int incSin, [In, Out] float[] cos, int incCos, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_abs_strided(int n, float[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_exp_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_log_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_sqrt_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_inverse_sqrt_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_sin_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_cos_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_tanh_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_erf_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_erf_inverse_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_cdf_normal_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_log_gamma_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_inverse_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_sin_cos_strided(int n, double[] x, int incx, [In, Out] double[] sin, int incSin, [In, Out] double[] cos, int incCos, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_abs_strided(int n, double[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_exp_strided(int n, Complex32[] x, int incx, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_log_strided(int n, Complex32[] x, int incx, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_sqrt_strided(int n, Complex32[] x, int incx, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_sin_strided(int n, Complex32[] x, int incx, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_cos_strided(int n, Complex32[] x, int incx, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_tanh_strided(int n, Complex32[] x, int incx, [In, Out] Complex32[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_abs_strided(int n, Complex32[] x, int incx, [In, Out] float[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_exp_strided(int n, Complex[] x, int incx, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_log_strided(int n, Complex[] x, int incx, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_sqrt_strided(int n, Complex[] x, int incx, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_sin_strided(int n, Complex[] x, int incx, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_cos_strided(int n, Complex[] x, int incx, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_tanh_strided(int n, Complex[] x, int incx, [In, Out] Complex[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_abs_strided(int n, Complex[] x, int incx, [In, Out] double[] result, int incResult, uint mode);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float s_vector_sum(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double d_vector_sum(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float s_vector_sum_squares(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double d_vector_sum_squares(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_vector_min_index(int n, float[] x, out float value);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_vector_min_index(int n, double[] x, out double value);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_vector_max_index(int n, float[] x, out float value);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_vector_max_index(int n, double[] x, out double value);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_sum(int axis, int rows, int columns, float[] a, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_sum(int axis, int rows, int columns, double[] a, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_sum_squares(int axis, int rows, int columns, float[] a, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_sum_squares(int axis, int rows, int columns, double[] a, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_min_index(int axis, int rows, int columns, float[] a, [In, Out] int[] indices, [In, Out] float[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_min_index(int axis, int rows, int columns, double[] a, [In, Out] int[] indices, [In, Out] double[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_max_index(int axis, int rows, int columns, float[] a, [In, Out] int[] indices, [In, Out] float[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_max_index(int axis, int rows, int columns, double[] a, [In, Out] int[] indices, [In, Out] double[] values);
+
+        #endregion  Vector Functions
+
+        #region FFT
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_fft_free([In] ref IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_create([Out] out IntPtr handle, int n, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_create([Out] out IntPtr handle, int n, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_create([Out] out IntPtr handle, int n, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_create([Out] out IntPtr handle, int n, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_create_multidim([Out] out IntPtr handle, int dimensions, [In] int[] n, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_create_multidim([Out] out IntPtr handle, int dimensions, [In] int[] n, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_forward([In] IntPtr handle, [In, Out] Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_forward([In] IntPtr handle, [In, Out] Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_forward([In] IntPtr handle, [In, Out] double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_forward([In] IntPtr handle, [In, Out] float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_backward([In] IntPtr handle, [In, Out] Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_backward([In] IntPtr handle, [In, Out] Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_backward([In] IntPtr handle, [In, Out] double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_backward([In] IntPtr handle, [In, Out] float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_create_outofplace([Out] out IntPtr handle, int n, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_create_outofplace([Out] out IntPtr handle, int n, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_create_outofplace([Out] out IntPtr handle, int n, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_create_outofplace([Out] out IntPtr handle, int n, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_create_multidim_outofplace([Out] out IntPtr handle, int dimensions, [In] int[] n, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_create_multidim_outofplace([Out] out IntPtr handle, int dimensions, [In] int[] n, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_forward_outofplace([In] IntPtr handle, [In] Complex[] x, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_forward_outofplace([In] IntPtr handle, [In] Complex32[] x, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_forward_outofplace([In] IntPtr handle, [In] double[] x, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_forward_outofplace([In] IntPtr handle, [In] float[] x, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_backward_outofplace([In] IntPtr handle, [In] Complex[] x, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_backward_outofplace([In] IntPtr handle, [In] Complex32[] x, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_backward_outofplace([In] IntPtr handle, [In] Complex[] x, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_backward_outofplace([In] IntPtr handle, [In] Complex32[] x, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_create_batch([Out] out IntPtr handle, int n, int transforms, int input_distance, int output_distance, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_create_batch([Out] out IntPtr handle, int n, int transforms, int input_distance, int output_distance, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_create_batch([Out] out IntPtr handle, int n, int transforms, int input_distance, int output_distance, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_create_batch([Out] out IntPtr handle, int n, int transforms, int input_distance, int output_distance, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_create_batch_outofplace([Out] out IntPtr handle, int n, int transforms, int input_distance, int output_distance, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_create_batch_outofplace([Out] out IntPtr handle, int n, int transforms, int input_distance, int output_distance, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_create_batch_outofplace([Out] out IntPtr handle, int n, int transforms, int input_distance, int output_distance, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_create_batch_outofplace([Out] out IntPtr handle, int n, int transforms, int input_distance, int output_distance, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_fft_free_real_multidim([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_create_multidim([Out] out IntPtr handle, int dimensions, [In] int[] n, double forward_scale, double backward_scale, int storage);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_create_multidim([Out] out IntPtr handle, int dimensions, [In] int[] n, float forward_scale, float backward_scale, int storage);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_create_multidim_outofplace([Out] out IntPtr handle, int dimensions, [In] int[] n, double forward_scale, double backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_create_multidim_outofplace([Out] out IntPtr handle, int dimensions, [In] int[] n, float forward_scale, float backward_scale);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_real_multidim_forward([In] IntPtr handle, [In, Out] double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_real_multidim_forward([In] IntPtr handle, [In, Out] float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_real_multidim_backward([In] IntPtr handle, [In, Out] double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_real_multidim_backward([In] IntPtr handle, [In, Out] float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_real_multidim_forward_outofplace([In] IntPtr handle, [In] double[] x, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_real_multidim_forward_outofplace([In] IntPtr handle, [In] float[] x, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_real_multidim_backward_outofplace([In] IntPtr handle, [In] Complex[] x, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_real_multidim_backward_outofplace([In] IntPtr handle, [In] Complex32[] x, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_fft_cache_acquire([Out] out IntPtr handle, int dimensions, [In] int[] n, double forward_scale, double backward_scale, int inplace);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_fft_cache_acquire([Out] out IntPtr handle, int dimensions, [In] int[] n, float forward_scale, float backward_scale, int inplace);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_fft_cache_acquire([Out] out IntPtr handle, int dimensions, [In] int[] n, double forward_scale, double backward_scale, int inplace);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_fft_cache_acquire([Out] out IntPtr handle, int dimensions, [In] int[] n, float forward_scale, float backward_scale, int inplace);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_fft_cache_release([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_fft_cache_set_capacity(int capacity);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_fft_cache_clear();
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_fft_cache_statistics(out long hits, out long misses, out long evictions, out int count);
+
+        #endregion FFT
+
+        #region Direct Sparse Solver
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_dss_solve(int matrixStructure, int matrixType, int systemType,
+            int rowCount, int columnCount, int nonZerosCount, int[] rowPointers, int[] columnIndices, float[] values,
+            int nRhs, [In, Out] float[] rhs, [In, Out] float[] solution);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_dss_solve(int matrixStructure, int matrixType, int systemType,
+            int rowCount, int columnCount, int nonZerosCount, int[] rowPointers, int[] columnIndices, double[] values,
+            int nRhs, [In, Out] double[] rhs, [In, Out] double[] solution);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_dss_solve(int matrixStructure, int matrixType, int systemType,
+            int rowCount, int columnCount, int nonZerosCount, int[] rowPointers, int[] columnIndices, Complex32[] values,
+            int nRhs, [In, Out] Complex32[] rhs, [In, Out] Complex32[] solution);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_dss_solve(int matrixStructure, int matrixType, int systemType,
+            int rowCount, int columnCount, int nonZerosCount, int[] rowPointers, int[] columnIndices, Complex[] values,
+            int nRhs, [In, Out] Complex[] rhs, [In, Out] Complex[] solution);
+
+        #endregion Direct Sparse Solver
+
+        #region Sparse BLAS
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_sparse_create_csr([Out] out IntPtr handle, int matrixType, int fillMode, int diagType, int rows, int columns, int nonZerosCount, int[] rowPointers, int[] columnIndices, float[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_sparse_create_csr([Out] out IntPtr handle, int matrixType, int fillMode, int diagType, int rows, int columns, int nonZerosCount, int[] rowPointers, int[] columnIndices, double[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_sparse_create_csr([Out] out IntPtr handle, int matrixType, int fillMode, int diagType, int rows, int columns, int nonZerosCount, int[] rowPointers, int[] columnIndices, Complex32[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_sparse_create_csr([Out] out IntPtr handle, int matrixType, int fillMode, int diagType, int rows, int columns, int nonZerosCount, int[] rowPointers, int[] columnIndices, Complex[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_sparse_set_mv_hint([In] IntPtr handle, int operation, int expectedCalls);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_sparse_set_mm_hint([In] IntPtr handle, int operation, int columns, int expectedCalls);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_sparse_optimize([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_sparse_free([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_sparse_mv([In] IntPtr handle, int operation, float alpha, float[] x, float beta, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_sparse_mv([In] IntPtr handle, int operation, double alpha, double[] x, double beta, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_sparse_mv([In] IntPtr handle, int operation, Complex32 alpha, Complex32[] x, Complex32 beta, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_sparse_mv([In] IntPtr handle, int operation, Complex alpha, Complex[] x, Complex beta, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_sparse_mm([In] IntPtr handle, int operation, float alpha, int columns, float[] x, float beta, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_sparse_mm([In] IntPtr handle, int operation, double alpha, int columns, double[] x, double beta, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_sparse_mm([In] IntPtr handle, int operation, Complex32 alpha, int columns, Complex32[] x, Complex32 beta, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_sparse_mm([In] IntPtr handle, int operation, Complex alpha, int columns, Complex[] x, Complex beta, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_sparse_multiply_symbolic([Out] out IntPtr product, int operationA, [In] IntPtr a, int operationB, [In] IntPtr b, out int rows, out int columns, out int nonZerosCount);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_sparse_multiply_symbolic([Out] out IntPtr product, int operationA, [In] IntPtr a, int operationB, [In] IntPtr b, out int rows, out int columns, out int nonZerosCount);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_sparse_multiply_symbolic([Out] out IntPtr product, int operationA, [In] IntPtr a, int operationB, [In] IntPtr b, out int rows, out int columns, out int nonZerosCount);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_sparse_multiply_symbolic([Out] out IntPtr product, int operationA, [In] IntPtr a, int operationB, [In] IntPtr b, out int rows, out int columns, out int nonZerosCount);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_sparse_multiply_numeric([In] IntPtr product, [Out] int[] rowPointers, [Out] int[] columnIndices, [Out] float[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_sparse_multiply_numeric([In] IntPtr product, [Out] int[] rowPointers, [Out] int[] columnIndices, [Out] double[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_sparse_multiply_numeric([In] IntPtr product, [Out] int[] rowPointers, [Out] int[] columnIndices, [Out] Complex32[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_sparse_multiply_numeric([In] IntPtr product, [Out] int[] rowPointers, [Out] int[] columnIndices, [Out] Complex[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_sparse_product_free([In] IntPtr product);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_sparse_multiply_dense(int operationA, [In] IntPtr a, [In] IntPtr b, [Out] float[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_sparse_multiply_dense(int operationA, [In] IntPtr a, [In] IntPtr b, [Out] double[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_sparse_multiply_dense(int operationA, [In] IntPtr a, [In] IntPtr b, [Out] Complex32[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_sparse_multiply_dense(int operationA, [In] IntPtr a, [In] IntPtr b, [Out] Complex[] c);
+
+        #endregion Sparse BLAS
+
+        #region Summary Statistics
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_summary_statistics_create([Out] out IntPtr handle, int dimension, int observationsInColumns, long estimates, int quantileCount, float[] quantileOrders, float epsilon);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_summary_statistics_update([In] IntPtr handle, int observations, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_summary_statistics_get([In] IntPtr handle, long estimate, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float s_summary_statistics_count([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_summary_statistics_create([Out] out IntPtr handle, int dimension, int observationsInColumns, long estimates, int quantileCount, double[] quantileOrders, double epsilon);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_summary_statistics_update([In] IntPtr handle, int observations, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_summary_statistics_get([In] IntPtr handle, long estimate, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double d_summary_statistics_count([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_summary_statistics_free([In] IntPtr handle);
+
+        #endregion Summary Statistics
+
+        #region Random Numbers
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_create([Out] out IntPtr stream, int generator, int member, uint seed);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_copy([Out] out IntPtr copy, [In] IntPtr stream);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_skip_ahead([In] IntPtr stream, long skip);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_leapfrog([In] IntPtr stream, int index, int streams);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_free([In] IntPtr stream);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_random_uniform([In] IntPtr stream, int n, float a, float b, [In, Out] float[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_random_uniform([In] IntPtr stream, int n, double a, double b, [In, Out] double[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_random_gaussian([In] IntPtr stream, int n, float mean, float sigma, [In, Out] float[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_random_gaussian([In] IntPtr stream, int n, double mean, double sigma, [In, Out] double[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_random_exponential([In] IntPtr stream, int n, float displacement, float beta, [In, Out] float[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_random_exponential([In] IntPtr stream, int n, double displacement, double beta, [In, Out] double[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_poisson([In] IntPtr stream, int n, double lambda, [In, Out] int[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_random_multivariate_gaussian([In] IntPtr stream, int n, int dimension, float[] mean, float[] cholesky, [In, Out] float[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_random_multivariate_gaussian([In] IntPtr stream, int n, int dimension, double[] mean, double[] cholesky, [In, Out] double[] r);
+
+        #endregion Random Numbers
+
+        #region Convolution
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_convolution_create([Out] out IntPtr handle, int correlation, int mode, int dimensions, int[] kernelShape, int[] signalShape, int[] resultShape, int[] start, float[] kernel);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_convolution_create([Out] out IntPtr handle, int correlation, int mode, int dimensions, int[] kernelShape, int[] signalShape, int[] resultShape, int[] start, double[] kernel);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_convolution_create([Out] out IntPtr handle, int correlation, int mode, int dimensions, int[] kernelShape, int[] signalShape, int[] resultShape, int[] start, Complex32[] kernel);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_convolution_create([Out] out IntPtr handle, int correlation, int mode, int dimensions, int[] kernelShape, int[] signalShape, int[] resultShape, int[] start, Complex[] kernel);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_convolution_execute([In] IntPtr handle, float[] signal, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_convolution_execute([In] IntPtr handle, double[] signal, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_convolution_execute([In] IntPtr handle, Complex32[] signal, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_convolution_execute([In] IntPtr handle, Complex[] signal, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_convolution_free([In] IntPtr handle);
+
+        #endregion Convolution
+
+        #region Data Fitting
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_spline_create([Out] out IntPtr handle, int order, int type, int boundary, float[] boundaryValues, int knots, float[] x, int functions, float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_spline_create([Out] out IntPtr handle, int order, int type, int boundary, double[] boundaryValues, int knots, double[] x, int functions, double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_spline_interpolate([In] IntPtr handle, int sites, float[] x, int sorted, int cellHint, int derivatives, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_spline_interpolate([In] IntPtr handle, int sites, double[] x, int sorted, int cellHint, int derivatives, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_spline_free([In] IntPtr handle);
+
+        #endregion Data Fitting
 
         // ReSharper restore InconsistentNaming
     }
@@ -120,6 +120,12 @@ public static int Load(string hintPath = null)
                 throw new NotSupportedException("OpenBLAS Native Provider too old. Consider upgrading to a newer version.");
             }
 
+            // The ILP64 builds are for native consumers only: the exports of this provider pass 32-bit integers.
+            if (SafeNativeMethods.query_capability((int)ProviderConfig.IntegerSize) == 8)
+            {
+                throw new NotSupportedException("OpenBLAS Native Provider is an ILP64 build, which is not supported from .NET. Please use the regular x64 build.");
+            }
+
             // set threading settings, if supported
             if (SafeNativeMethods.query_capability((int)ProviderConfig.Threading) > 0)
             {
@@ -39,6 +39,7 @@ internal enum ProviderPlatform : int
 
     internal enum ProviderConfig : int
     {
+        IntegerSize = 5,
         Revision = 64,
         Threading = 66,
     }
@@ -46,6 +47,10 @@ internal enum ProviderConfig : int
     internal enum ProviderCapability : int
     {
         LinearAlgebraMajor = 128,
-        LinearAlgebraMinor = 129
+        LinearAlgebraMinor = 129,
+        VectorFunctionsMajor = 130,
+        VectorFunctionsMinor = 131,
+        RandomNumbersMajor = 642,
+        RandomNumbersMinor = 643
     }
 }
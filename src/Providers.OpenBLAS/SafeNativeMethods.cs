@@ -26,6 +26,7 @@
 // OTHER DEALINGS IN THE SOFTWARE.
 // </copyright>
 
+using System;
 using System.Runtime.InteropServices;
 using System.Security;
 using MathNet.Numerics.Providers.LinearAlgebra;
@@ -99,6 +100,12 @@ internal static class SafeNativeMethods
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
         internal static extern Complex z_dot_product(int n, Complex[] x, Complex[] y);
 
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern Complex32 c_conjugate_dot_product(int n, Complex32[] x, Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern Complex z_conjugate_dot_product(int n, Complex[] x, Complex[] y);
+
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void s_matrix_multiply(Transpose transA, Transpose transB, int m, int n, int k, float alpha, float[] x, float[] y, float beta, [In, Out] float[] c);
 
@@ -111,6 +118,330 @@ internal static class SafeNativeMethods
         [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void z_matrix_multiply(Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, Complex[] x, Complex[] y, Complex beta, [In, Out] Complex[] c);
 
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_view(Transpose transA, Transpose transB, int m, int n, int k, float alpha, float[] x, IntPtr xOffset, int lda, float[] y, IntPtr yOffset, int ldb, float beta, [In, Out] float[] c, IntPtr cOffset, int ldc);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_view(Transpose transA, Transpose transB, int m, int n, int k, double alpha, double[] x, IntPtr xOffset, int lda, double[] y, IntPtr yOffset, int ldb, double beta, [In, Out] double[] c, IntPtr cOffset, int ldc);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_view(Transpose transA, Transpose transB, int m, int n, int k, Complex32 alpha, Complex32[] x, IntPtr xOffset, int lda, Complex32[] y, IntPtr yOffset, int ldb, Complex32 beta, [In, Out] Complex32[] c, IntPtr cOffset, int ldc);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_view(Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, Complex[] x, IntPtr xOffset, int lda, Complex[] y, IntPtr yOffset, int ldb, Complex beta, [In, Out] Complex[] c, IntPtr cOffset, int ldc);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_batch(Transpose transA, Transpose transB, int m, int n, int k, float alpha, IntPtr[] x, IntPtr[] y, float beta, IntPtr[] c, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_batch(Transpose transA, Transpose transB, int m, int n, int k, double alpha, IntPtr[] x, IntPtr[] y, double beta, IntPtr[] c, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_batch(Transpose transA, Transpose transB, int m, int n, int k, Complex32 alpha, IntPtr[] x, IntPtr[] y, Complex32 beta, IntPtr[] c, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_batch(Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, IntPtr[] x, IntPtr[] y, Complex beta, IntPtr[] c, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_batch_strided(Transpose transA, Transpose transB, int m, int n, int k, float alpha, float[] x, int xStride, float[] y, int yStride, float beta, [In, Out] float[] c, int cStride, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_batch_strided(Transpose transA, Transpose transB, int m, int n, int k, double alpha, double[] x, int xStride, double[] y, int yStride, double beta, [In, Out] double[] c, int cStride, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_batch_strided(Transpose transA, Transpose transB, int m, int n, int k, Complex32 alpha, Complex32[] x, int xStride, Complex32[] y, int yStride, Complex32 beta, [In, Out] Complex32[] c, int cStride, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_batch_strided(Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, Complex[] x, int xStride, Complex[] y, int yStride, Complex beta, [In, Out] Complex[] c, int cStride, int batchSize);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_vector_multiply(Transpose trans, int m, int n, float alpha, float[] a, float[] x, float beta, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_vector_multiply(Transpose trans, int m, int n, double alpha, double[] a, double[] x, double beta, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_vector_multiply(Transpose trans, int m, int n, Complex32 alpha, Complex32[] a, Complex32[] x, Complex32 beta, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_vector_multiply(Transpose trans, int m, int n, Complex alpha, Complex[] a, Complex[] x, Complex beta, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_symmetric_matrix_vector_multiply(int uplo, int n, float alpha, float[] a, float[] x, float beta, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_symmetric_matrix_vector_multiply(int uplo, int n, double alpha, double[] a, double[] x, double beta, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_hermitian_matrix_vector_multiply(int uplo, int n, Complex32 alpha, Complex32[] a, Complex32[] x, Complex32 beta, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_hermitian_matrix_vector_multiply(int uplo, int n, Complex alpha, Complex[] a, Complex[] x, Complex beta, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_triangular_matrix_vector_multiply(int uplo, Transpose trans, int diag, int n, float[] a, [In, Out] float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_triangular_matrix_vector_multiply(int uplo, Transpose trans, int diag, int n, double[] a, [In, Out] double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_triangular_matrix_vector_multiply(int uplo, Transpose trans, int diag, int n, Complex32[] a, [In, Out] Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_triangular_matrix_vector_multiply(int uplo, Transpose trans, int diag, int n, Complex[] a, [In, Out] Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_triangular_matrix_vector_solve(int uplo, Transpose trans, int diag, int n, float[] a, [In, Out] float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_triangular_matrix_vector_solve(int uplo, Transpose trans, int diag, int n, double[] a, [In, Out] double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_triangular_matrix_vector_solve(int uplo, Transpose trans, int diag, int n, Complex32[] a, [In, Out] Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_triangular_matrix_vector_solve(int uplo, Transpose trans, int diag, int n, Complex[] a, [In, Out] Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_rank_one_update(int m, int n, float alpha, float[] x, float[] y, [In, Out] float[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_rank_one_update(int m, int n, double alpha, double[] x, double[] y, [In, Out] double[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_rank_one_update(int m, int n, Complex32 alpha, Complex32[] x, Complex32[] y, [In, Out] Complex32[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_rank_one_update(int m, int n, Complex alpha, Complex[] x, Complex[] y, [In, Out] Complex[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_conjugate_rank_one_update(int m, int n, Complex32 alpha, Complex32[] x, Complex32[] y, [In, Out] Complex32[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_conjugate_rank_one_update(int m, int n, Complex alpha, Complex[] x, Complex[] y, [In, Out] Complex[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_symmetric_rank_k_update(int uplo, Transpose trans, int n, int k, float alpha, float[] a, float beta, [In, Out] float[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_symmetric_rank_k_update(int uplo, Transpose trans, int n, int k, double alpha, double[] a, double beta, [In, Out] double[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_hermitian_rank_k_update(int uplo, Transpose trans, int n, int k, float alpha, Complex32[] a, float beta, [In, Out] Complex32[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_hermitian_rank_k_update(int uplo, Transpose trans, int n, int k, double alpha, Complex[] a, double beta, [In, Out] Complex[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_triangle(int uplo, Transpose transA, Transpose transB, int n, int k, float alpha, float[] x, float[] y, float beta, [In, Out] float[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_triangle(int uplo, Transpose transA, Transpose transB, int n, int k, double alpha, double[] x, double[] y, double beta, [In, Out] double[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_triangle(int uplo, Transpose transA, Transpose transB, int n, int k, Complex32 alpha, Complex32[] x, Complex32[] y, Complex32 beta, [In, Out] Complex32[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_triangle(int uplo, Transpose transA, Transpose transB, int n, int k, Complex alpha, Complex[] x, Complex[] y, Complex beta, [In, Out] Complex[] c, [MarshalAs(UnmanagedType.Bool)] bool mirror);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_triangular_solve(int side, int uplo, Transpose trans, int diag, int m, int n, float alpha, float[] a, [In, Out] float[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_triangular_solve(int side, int uplo, Transpose trans, int diag, int m, int n, double alpha, double[] a, [In, Out] double[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_triangular_solve(int side, int uplo, Transpose trans, int diag, int m, int n, Complex32 alpha, Complex32[] a, [In, Out] Complex32[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_triangular_solve(int side, int uplo, Transpose trans, int diag, int m, int n, Complex alpha, Complex[] a, [In, Out] Complex[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_triangular_multiply(int side, int uplo, Transpose trans, int diag, int m, int n, float alpha, float[] a, [In, Out] float[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_triangular_multiply(int side, int uplo, Transpose trans, int diag, int m, int n, double alpha, double[] a, [In, Out] double[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_triangular_multiply(int side, int uplo, Transpose trans, int diag, int m, int n, Complex32 alpha, Complex32[] a, [In, Out] Complex32[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_triangular_multiply(int side, int uplo, Transpose trans, int diag, int m, int n, Complex alpha, Complex[] a, [In, Out] Complex[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_matrix_multiply_kernel_create([Out] out IntPtr handle, Transpose transA, Transpose transB, int m, int n, int k, float alpha, float beta);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_matrix_multiply_kernel_create([Out] out IntPtr handle, Transpose transA, Transpose transB, int m, int n, int k, double alpha, double beta);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_matrix_multiply_kernel_create([Out] out IntPtr handle, Transpose transA, Transpose transB, int m, int n, int k, Complex32 alpha, Complex32 beta);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_matrix_multiply_kernel_create([Out] out IntPtr handle, Transpose transA, Transpose transB, int m, int n, int k, Complex alpha, Complex beta);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_kernel_execute([In] IntPtr handle, float[] x, float[] y, [In, Out] float[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_kernel_execute([In] IntPtr handle, double[] x, double[] y, [In, Out] double[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_matrix_multiply_kernel_execute([In] IntPtr handle, Complex32[] x, Complex32[] y, [In, Out] Complex32[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_matrix_multiply_kernel_execute([In] IntPtr handle, Complex[] x, Complex[] y, [In, Out] Complex[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_matrix_multiply_kernel_free([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float s_vector_norm(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double d_vector_norm(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float c_vector_norm(int n, Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double z_vector_norm(int n, Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float s_absolute_sum(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double d_absolute_sum(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float c_absolute_sum(int n, Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double z_absolute_sum(int n, Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_max_abs_index(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_max_abs_index(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_max_abs_index(int n, Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_max_abs_index(int n, Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_min_abs_index(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_min_abs_index(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_min_abs_index(int n, Complex32[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_min_abs_index(int n, Complex[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_axpby(int n, float alpha, float[] x, float beta, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_axpby(int n, double alpha, double[] x, double beta, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_axpby(int n, Complex32 alpha, Complex32[] x, Complex32 beta, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_axpby(int n, Complex alpha, Complex[] x, Complex beta, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_rotate(int n, [In, Out] float[] x, [In, Out] float[] y, float c, float s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_rotate(int n, [In, Out] double[] x, [In, Out] double[] y, double c, double s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_rotate(int n, [In, Out] Complex32[] x, [In, Out] Complex32[] y, float c, float s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_rotate(int n, [In, Out] Complex[] x, [In, Out] Complex[] y, double c, double s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_rotate_generate(ref float a, ref float b, out float c, out float s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_rotate_generate(ref double a, ref double b, out double c, out double s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_rotate_generate(ref Complex32 a, ref Complex32 b, out float c, out Complex32 s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_rotate_generate(ref Complex a, ref Complex b, out double c, out Complex s);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_swap(int n, [In, Out] float[] x, [In, Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_swap(int n, [In, Out] double[] x, [In, Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_swap(int n, [In, Out] Complex32[] x, [In, Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_swap(int n, [In, Out] Complex[] x, [In, Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_copy(int n, float[] x, [Out] float[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_copy(int n, double[] x, [Out] double[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_copy(int n, Complex32[] x, [Out] Complex32[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_copy(int n, Complex[] x, [Out] Complex[] y);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_matrix_multiply_pack([Out] out IntPtr handle, Transpose transA, int m, int k, float alpha, float[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_matrix_multiply_pack([Out] out IntPtr handle, Transpose transA, int m, int k, double alpha, double[] a);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_multiply_packed([In] IntPtr handle, Transpose transB, int n, float[] y, float beta, [In, Out] float[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_multiply_packed([In] IntPtr handle, Transpose transB, int n, double[] y, double beta, [In, Out] double[] c);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void x_matrix_multiply_pack_free([In] IntPtr handle);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_transpose(Transpose trans, int rows, int cols, float alpha, float[] a, [Out] float[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_transpose(Transpose trans, int rows, int cols, double alpha, double[] a, [Out] double[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_transpose(Transpose trans, int rows, int cols, Complex32 alpha, Complex32[] a, [Out] Complex32[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_transpose(Transpose trans, int rows, int cols, Complex alpha, Complex[] a, [Out] Complex[] b);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_transpose_inplace(Transpose trans, int rows, int cols, float alpha, [In, Out] float[] ab);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_transpose_inplace(Transpose trans, int rows, int cols, double alpha, [In, Out] double[] ab);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int c_transpose_inplace(Transpose trans, int rows, int cols, Complex32 alpha, [In, Out] Complex32[] ab);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int z_transpose_inplace(Transpose trans, int rows, int cols, Complex alpha, [In, Out] Complex[] ab);
+
         #endregion BLAS
 
         #region LAPACK
@@ -296,5 +627,163 @@ internal static class SafeNativeMethods
         internal static extern int z_eigen([MarshalAs(UnmanagedType.U1)] bool isSymmetric, int n, [In] Complex[] a, [In, Out] Complex[] vectors, [In, Out] Complex[] values, [In, Out] Complex[] d);
 
         #endregion LAPACK
+
+        #region Vector Functions
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_add(int n, float[] x, float[] y, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_subtract(int n, float[] x, float[] y, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_multiply(int n, float[] x, float[] y, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_divide(int n, float[] x, float[] y, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_vector_power(int n, float[] x, float[] y, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_add(int n, double[] x, double[] y, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_subtract(int n, double[] x, double[] y, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_multiply(int n, double[] x, double[] y, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_divide(int n, double[] x, double[] y, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_vector_power(int n, double[] x, double[] y, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_add(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_subtract(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_multiply(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_divide(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void c_vector_power(int n, Complex32[] x, Complex32[] y, [In, Out] Complex32[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_add(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_subtract(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_multiply(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_divide(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void z_vector_power(int n, Complex[] x, Complex[] y, [In, Out] Complex[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float s_vector_sum(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double d_vector_sum(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern float s_vector_sum_squares(int n, float[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern double d_vector_sum_squares(int n, double[] x);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_vector_min_index(int n, float[] x, out float value);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_vector_min_index(int n, double[] x, out double value);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_vector_max_index(int n, float[] x, out float value);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_vector_max_index(int n, double[] x, out double value);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_sum(int axis, int rows, int columns, float[] a, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_sum(int axis, int rows, int columns, double[] a, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_sum_squares(int axis, int rows, int columns, float[] a, [In, Out] float[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_sum_squares(int axis, int rows, int columns, double[] a, [In, Out] double[] result);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_min_index(int axis, int rows, int columns, float[] a, [In, Out] int[] indices, [In, Out] float[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_min_index(int axis, int rows, int columns, double[] a, [In, Out] int[] indices, [In, Out] double[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void s_matrix_max_index(int axis, int rows, int columns, float[] a, [In, Out] int[] indices, [In, Out] float[] values);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern void d_matrix_max_index(int axis, int rows, int columns, double[] a, [In, Out] int[] indices, [In, Out] double[] values);
+
+        #endregion Vector Functions
+
+        #region Random Numbers
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_create([Out] out IntPtr stream, int generator, int member, uint seed);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_copy([Out] out IntPtr copy, [In] IntPtr stream);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_skip_ahead([In] IntPtr stream, long skip);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_leapfrog([In] IntPtr stream, int index, int streams);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_free([In] IntPtr stream);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_random_uniform([In] IntPtr stream, int n, float a, float b, [In, Out] float[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_random_uniform([In] IntPtr stream, int n, double a, double b, [In, Out] double[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_random_gaussian([In] IntPtr stream, int n, float mean, float sigma, [In, Out] float[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_random_gaussian([In] IntPtr stream, int n, double mean, double sigma, [In, Out] double[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_random_exponential([In] IntPtr stream, int n, float displacement, float beta, [In, Out] float[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_random_exponential([In] IntPtr stream, int n, double displacement, double beta, [In, Out] double[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int x_random_poisson([In] IntPtr stream, int n, double lambda, [In, Out] int[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int s_random_multivariate_gaussian([In] IntPtr stream, int n, int dimension, float[] mean, float[] cholesky, [In, Out] float[] r);
+
+        [DllImport(DllName, ExactSpelling = true, SetLastError = false, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int d_random_multivariate_gaussian([In] IntPtr stream, int n, int dimension, double[] mean, double[] cholesky, [In, Out] double[] r);
+
+        #endregion Random Numbers
     }
 }